@@ -6,6 +6,7 @@
 #define CUDA_RAY_TRACER_AABB_H
 
 #include "../Utilities.h"
+#include "Intersection_Kernels.h"
 
 class AABB {
 public:
@@ -29,26 +30,28 @@ public:
     // Supporting Functions
     // -----------------------------------------------------------------------
     /// Reference: Fundamentals of Computer Graphics - Section 12.3.1: Bounding Boxes
+    template <typename Kernel = Default_AABB_Kernel>
     bool intersection(const Ray& r, double t_min, double t_max) const {
-        // Checks if ray r intersect the AABB within the interval [t_min,t_max]
-        // NOTE: When measuring runtime, don't call this function; instead, paste the intersection code here.
+        // Checks if ray r intersect the AABB within the interval [t_min,t_max], with the algorithm
+        // Kernel (see Intersection_Kernels.h)
 
        //  num_calls_box_intersection++;            // how many times is this function called?
 
-       return Williams_ray_AABB_intersection(r, t_min, t_max);
-       // return Tavian_ray_AABB_intersection(r, t_min, t_max);
-       // return slab_method(r, t_min, t_max);
-       // return our_ray_AABB_intersection(r, t_min, t_max);
-       // return Kensler_ray_AABB_intersection_method(r, t_min, t_max);
+        return intersection(r, t_min, t_max, Kernel());
     }
 
+    bool intersection(const Ray& r, double t_min, double t_max, Williams_AABB) const { return Williams_ray_AABB_intersection(r, t_min, t_max); }
+    bool intersection(const Ray& r, double t_min, double t_max, Tavian_AABB) const { return Tavian_ray_AABB_intersection(r, t_min, t_max); }
+    bool intersection(const Ray& r, double t_min, double t_max, Slab_AABB) const { return slab_method(r, t_min, t_max); }
+    bool intersection(const Ray& r, double t_min, double t_max, Our_AABB) const { return our_ray_AABB_intersection(r, t_min, t_max); }
+    bool intersection(const Ray& r, double t_min, double t_max, Kensler_AABB) const { return Kensler_ray_AABB_intersection_method(r, t_min, t_max); }
+
     inline double volume() const {
         // Calculates the volume of the AABB
         return (maximum.x() - minimum.x()) * (maximum.y() - minimum.y()) * (maximum.z() - minimum.z());
     }
 
-private:
-    // Supporting Functions
+    // Intersection Algorithms (public so that Benchmarks/intersection_benchmark.cpp can time each one)
     // -----------------------------------------------------------------------
     bool slab_method(const Ray& r, double t_min, double t_max) const {
         Vec3D r_orig = r.get_ray_origin();
@@ -162,6 +165,7 @@ private:
         return ((tmin < t_max) && (tmax > t_min));
     }
 
+private:
     // Data Members
     // -----------------------------------------------------------------------
     point3D minimum;            // point at the minimum corner of the box
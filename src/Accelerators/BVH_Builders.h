@@ -0,0 +1,120 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_BVH_BUILDERS_H
+#define CUDA_RAY_TRACER_BVH_BUILDERS_H
+
+#include "BVH.h"
+#include "BVH_Max_Coordinate.h"
+#include "BVH_Centroid_Coordinate.h"
+#include "BVH_Fast.h"
+#include "BVH_Parallel.h"
+#include "BVH_Flat.h"
+#include "../NUMA_Placement.h"
+
+// The BVH variants, so that a scene can say which one it prefers while a benchmark can still
+// swap it for another one without editing the scene.
+// -----------------------------------------------------------------------
+enum BVH_BUILDER {
+    SCENE_DEFAULT_BVH,              // only meaningful as an override: keep what the scene asks for
+    BVH_ORIGINAL,
+    BVH_MAX_COORDINATE,
+    BVH_CENTROID_COORDINATE,
+    BVH_FAST,
+    BVH_PARALLEL,
+    BVH_FLAT
+};
+
+inline BVH_BUILDER& BVH_builder_override() {
+    // When set, build_BVH() ignores the scene's choice and uses this builder
+
+    static BVH_BUILDER builder = SCENE_DEFAULT_BVH;
+    return builder;
+}
+
+inline const char* BVH_builder_name(BVH_BUILDER b) {
+    switch (b) {
+        case SCENE_DEFAULT_BVH: return "scene_default";
+        case BVH_ORIGINAL: return "bvh";
+        case BVH_MAX_COORDINATE: return "bvh_max_coordinate";
+        case BVH_CENTROID_COORDINATE: return "bvh_centroid_coordinate";
+        case BVH_FAST: return "bvh_fast";
+        case BVH_PARALLEL: return "bvh_parallel";
+        case BVH_FLAT: return "bvh_flat";
+    }
+    return "?";
+}
+
+inline bool parse_BVH_builder(const std::string& name, BVH_BUILDER& b) {
+    for (int i = SCENE_DEFAULT_BVH; i <= BVH_FLAT; i++) {
+        if (name == BVH_builder_name(static_cast<BVH_BUILDER>(i))) {
+            b = static_cast<BVH_BUILDER>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline double& accumulated_BVH_build_time() {
+    // Seconds spent in build_BVH() since the last reset (the benchmark resets it before each scene)
+
+    static double seconds = 0.0;
+    return seconds;
+}
+
+template <typename AABB_Kernel, typename Triangle_Kernel = Default_Triangle_Kernel, typename Sphere_Kernel = Default_Sphere_Kernel>
+std::shared_ptr<Primitive> make_BVH(const Primitives_Group& world, BVH_BUILDER builder, double time0, double time1) {
+    // Builds the BVH variant "builder", traversed with the ray/AABB algorithm AABB_Kernel. BVH_Flat also
+    // needs the triangle and sphere kernels: it calls them directly instead of through Primitive.
+
+    switch (builder) {
+        case BVH_ORIGINAL: return std::make_shared<Basic_BVH<AABB_Kernel>>(world);
+        case BVH_MAX_COORDINATE: return std::make_shared<Basic_BVH_Max_Coordinate<AABB_Kernel>>(world);
+        case BVH_CENTROID_COORDINATE: return std::make_shared<Basic_BVH_Centroid_Coordinate<AABB_Kernel>>(world);
+        case BVH_PARALLEL: return std::make_shared<Basic_BVH_Parallel<AABB_Kernel>>(world, time0, time1);
+        case BVH_FLAT: return std::make_shared<Basic_BVH_Flat<AABB_Kernel, Triangle_Kernel, Sphere_Kernel>>(world, time0, time1);
+        default: return std::make_shared<Basic_BVH_Fast<AABB_Kernel>>(world, time0, time1);
+    }
+}
+
+typedef Primitives_Group (*BVH_Build_Function)(const Primitives_Group& world, BVH_BUILDER builder, double time0, double time1);
+
+inline BVH_Build_Function& BVH_build_function() {
+    // When set, build_BVH() hands the world to this function instead of building with the default kernels.
+    // The benchmark uses it to build with other kernel combinations (see Benchmarks/Kernel_Registry.h).
+
+    static BVH_Build_Function function = nullptr;
+    return function;
+}
+
+inline Primitives_Group build_BVH(const Primitives_Group& world, BVH_BUILDER scene_choice, double time0 = 0.0, double time1 = 0.0) {
+    // Builds a BVH over the world with the scene's builder, unless BVH_builder_override() is set.
+    // [time0,time1] is the shutter interval (only BVH_Fast, BVH_Parallel and BVH_Flat take it into account).
+    // With replicate_BVH_per_NUMA_node() set, the world gets one BVH per NUMA node (see NUMA_Placement.h).
+
+    BVH_BUILDER builder = (BVH_builder_override() != SCENE_DEFAULT_BVH) ? BVH_builder_override() : scene_choice;
+    double start = omp_get_wtime();
+
+    auto build = [&]() {
+        return BVH_build_function() ? BVH_build_function()(world, builder, time0, time1)
+                                    : Primitives_Group(make_BVH<Default_AABB_Kernel>(world, builder, time0, time1));
+    };
+
+    Primitives_Group bvh;
+    if (replicate_BVH_per_NUMA_node()) {
+        // One copy per NUMA node, each built (and so first touched) by a thread of its node
+        bvh.add_primitive_to_list(std::make_shared<NUMA_Replicated_Primitive>(build_on_every_NUMA_node([&]() {
+            Primitives_Group replica = build();
+            return replica.primitives_list.size() == 1 ? replica.primitives_list[0]
+                                                       : std::shared_ptr<Primitive>(std::make_shared<Primitives_Group>(replica));
+        })));
+    } else {
+        bvh = build();
+    }
+
+    accumulated_BVH_build_time() += omp_get_wtime() - start;
+    return bvh;
+}
+
+#endif //CUDA_RAY_TRACER_BVH_BUILDERS_H
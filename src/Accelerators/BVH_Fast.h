@@ -8,58 +8,22 @@
 #include "../Utilities.h"
 #include "../Primitives/Primitive.h"
 #include "../Primitives/Primitives_Group.h"
-
-class BVH_Fast : public Primitive {
+#include "../Memory_Arena.h"
+
+// BVH_Fast and BVH_Parallel keep their nodes in a Memory_Arena owned by the BVH, with plain pointers to the
+// children and to the primitives in the leaves. The BVH holds on to the primitives' std::shared_ptrs, so the
+// build itself copies no std::shared_ptr (no reference count traffic), and the nodes are freed all at once.
+// -----------------------------------------------------------------------
+template <typename AABB_Kernel = Default_AABB_Kernel>
+class Basic_BVH_Node : public Primitive {
 public:
-    BVH_Fast(const Primitives_Group &list) :
-            BVH_Fast(list.primitives_list, 0) {}
-
-    BVH_Fast(const std::vector<std::shared_ptr<Primitive>>& src_objects, int axis_ctr) {
-        auto objects = src_objects;
-
-        // int axis = random_int_in_range(0,2);       // choose the axis at random, or ...
-        int axis = axis_ctr % 3;                          // keep rotating between the axes
-
-        auto comparator = (axis == 0) ? box_x_compare_centroid_coord
-                                      : (axis == 1) ? box_y_compare_centroid_coord
-                                                    : box_z_compare_centroid_coord;
-
-        size_t size = objects.size();
-
-        if (size == 1) {
-            left = right = objects[0];
-        } else if (size == 2) {
-            if (comparator(objects[0], objects[1])) {
-                left = objects[0];
-                right = objects[1];
-            } else {
-                left = objects[1];
-                right = objects[0];
-            }
-        } else {
-            auto m = size / 2;
-
-            // can use sort:
-            // std::sort(objects.begin(), objects.end(), comparator);
-
-            // ... or can use partial_sort:
-            // std::partial_sort(objects.begin(), objects.begin() + m, objects.end(), comparator);
-
-            // ... or can use nth_element:
-            std::nth_element(objects.begin(), objects.begin() + m, objects.end(), comparator);
-
-            // Don't send the full lists, just send partial copies of them
-            auto first_half = std::vector<std::shared_ptr<Primitive>>(objects.begin(), objects.begin() + m);
-            auto second_half = std::vector<std::shared_ptr<Primitive>>(objects.begin() + m, objects.end());
-
-            // Invoke recursion
-            left = std::make_shared<BVH_Fast>(first_half, axis_ctr + 1);
-            right = std::make_shared<BVH_Fast>(second_half, axis_ctr + 1);
-        }
+    // Constructor
+    // -----------------------------------------------------------------------
+    Basic_BVH_Node(const Primitive* left, const Primitive* right, double time0, double time1) : left(left), right(right) {
         AABB box_left, box_right;
 
-        if (  !left->has_bounding_box(0.0, 0.0, box_left)
-              || !right->has_bounding_box(0.0, 0.0, box_right)
+        if (  !left->has_bounding_box(time0, time1, box_left)
+              || !right->has_bounding_box(time0, time1, box_right)
                 )
             std::cerr << "No bounding box in bvh_node constructor.\n";
 
@@ -70,7 +34,7 @@ public:
     // -----------------------------------------------------------------------
     bool intersection(const Ray &r, double t_0, double t_1, Intersection_Information &intersection_info) const override {
         /* A faster intersection method [1]. I will stick to this rather than my implementation below. */
-        if (!BBOX.intersection(r, t_0, t_1))
+        if (!BBOX.intersection<AABB_Kernel>(r, t_0, t_1))
             return false;
 
         bool hit_left = left->intersection(r, t_0, t_1, intersection_info);
@@ -86,9 +50,114 @@ public:
 public:
     // Data Members
     // -----------------------------------------------------------------------
-    std::shared_ptr<Primitive> left;        // left-child node
-    std::shared_ptr<Primitive> right;       // right-child node
+    const Primitive* left;                  // left-child node
+    const Primitive* right;                 // right-child node
     AABB BBOX;                              // bounding box of the BVH node
 };
 
+struct BVH_Build_Entry {
+    const Primitive* primitive;
+    point3D centroid;                       // of the primitive's bounding box at time 0
+};
+
+inline std::vector<BVH_Build_Entry> make_BVH_build_entries(const std::vector<std::shared_ptr<Primitive>>& objects) {
+    // The centroids are computed once here instead of in every comparison of the median split
+
+    if (objects.empty()) {
+        std::cerr << "CANNOT BUILD A BVH OVER AN EMPTY LIST!\n";
+        exit(0);
+    }
+
+    std::vector<BVH_Build_Entry> entries(objects.size());
+    for (size_t i = 0; i < objects.size(); i++) {
+        AABB box;
+        if (!objects[i]->has_bounding_box(0, 0, box)) {
+            std::cerr << "NO BOUNDING BOX";
+            exit(0);
+        }
+        entries[i].primitive = objects[i].get();
+        entries[i].centroid = box.get_centroid();
+    }
+    return entries;
+}
+
+template <typename AABB_Kernel>
+const Primitive* split_BVH_entries(Memory_Arena& arena, std::vector<BVH_Build_Entry>& entries, size_t begin, size_t end,
+                                   int axis_ctr, double time0, double time1, const Primitive*& left, const Primitive*& right) {
+    // The part of the build that BVH_Fast and BVH_Parallel share: a range of one or two primitives becomes a
+    // node over them (returned); a larger one is split at the median along the axis (left and right are left
+    // for the caller to build, over [begin, begin + (end-begin)/2) and the rest) and nullptr is returned.
+
+    int axis = axis_ctr % 3;                          // keep rotating between the axes
+    auto comparator = [axis](const BVH_Build_Entry& a, const BVH_Build_Entry& b) { return a.centroid[axis] < b.centroid[axis]; };
+
+    size_t size = end - begin;
+    if (size == 1) {
+        left = right = entries[begin].primitive;
+    } else if (size == 2) {
+        if (comparator(entries[begin], entries[begin + 1])) {
+            left = entries[begin].primitive;
+            right = entries[begin + 1].primitive;
+        } else {
+            left = entries[begin + 1].primitive;
+            right = entries[begin].primitive;
+        }
+    } else {
+        std::nth_element(entries.begin() + begin, entries.begin() + begin + size / 2, entries.begin() + end, comparator);
+        return nullptr;
+    }
+    return arena.make<Basic_BVH_Node<AABB_Kernel>>(left, right, time0, time1);
+}
+
+template <typename AABB_Kernel = Default_AABB_Kernel>
+class Basic_BVH_Fast : public Primitive {
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    Basic_BVH_Fast(const Primitives_Group &list, double time0 = 0.0, double time1 = 0.0) :
+            Basic_BVH_Fast(list.primitives_list, time0, time1) {}
+
+    Basic_BVH_Fast(const std::vector<std::shared_ptr<Primitive>>& src_objects, double time0 = 0.0, double time1 = 0.0) :
+            primitives(src_objects) {
+        // [time0,time1] is the shutter interval; moving primitives are bounded over all of it.
+
+        std::vector<BVH_Build_Entry> entries = make_BVH_build_entries(primitives);
+        root = build(entries, 0, entries.size(), 0, time0, time1);
+    }
+
+    // Overridden Functions
+    // -----------------------------------------------------------------------
+    bool intersection(const Ray &r, double t_0, double t_1, Intersection_Information &intersection_info) const override {
+        return root->intersection(r, t_0, t_1, intersection_info);
+    }
+
+    bool has_bounding_box(double time_0, double time_1, AABB &surrounding_AABB) const override {
+        return root->has_bounding_box(time_0, time_1, surrounding_AABB);
+    }
+
+private:
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    const Primitive* build(std::vector<BVH_Build_Entry>& entries, size_t begin, size_t end, int axis_ctr, double time0, double time1) {
+        const Primitive* left;
+        const Primitive* right;
+        const Primitive* node = split_BVH_entries<AABB_Kernel>(arena, entries, begin, end, axis_ctr, time0, time1, left, right);
+        if (node)
+            return node;
+
+        size_t m = begin + (end - begin) / 2;
+        left = build(entries, begin, m, axis_ctr + 1, time0, time1);
+        right = build(entries, m, end, axis_ctr + 1, time0, time1);
+        return arena.make<Basic_BVH_Node<AABB_Kernel>>(left, right, time0, time1);
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    std::vector<std::shared_ptr<Primitive>> primitives;     // keeps the primitives in the leaves alive
+    Memory_Arena arena;                                     // the nodes
+    const Primitive* root;
+};
+
+typedef Basic_BVH_Fast<> BVH_Fast;
+
 #endif //CUDA_RAY_TRACER_BVH_FAST_H
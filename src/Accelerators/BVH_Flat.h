@@ -0,0 +1,249 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_BVH_FLAT_H
+#define CUDA_RAY_TRACER_BVH_FLAT_H
+
+#include "../Utilities.h"
+#include "../Primitives/Primitive.h"
+#include "../Primitives/Primitives_Group.h"
+#include "../Primitives/Triangle.h"
+#include "../Primitives/Sphere.h"
+#include "../Primitives/XY_Rectangle.h"
+#include "../Primitives/XZ_Rectangle.h"
+#include "../Primitives/YZ_Rectangle.h"
+
+// A BVH without virtual calls in its inner loop. The other BVHs make every node and every leaf a
+// std::shared_ptr<Primitive> reached through a virtual intersection(); this one keeps
+//      - the nodes in one array, in depth-first order (the left child of node i is node i+1), and
+//      - the primitives by value in one contiguous array per type (triangles, spheres, XY/XZ/YZ rectangles).
+// A leaf is a range of (type, index) references, and the leaf loop switches on the type and calls the
+// concrete intersection() directly. Primitives of any other type (Box, transforms, moving spheres, ...)
+// go in other_primitives and are still called virtually.
+//
+// Traversal is iterative, visits the child on the ray's side of the split first, and shrinks t_1 to the
+// closest hit so far.
+// -----------------------------------------------------------------------
+enum PRIMITIVE_TYPE : unsigned char {
+    TRIANGLE_PRIMITIVE,
+    SPHERE_PRIMITIVE,
+    XY_RECTANGLE_PRIMITIVE,
+    XZ_RECTANGLE_PRIMITIVE,
+    YZ_RECTANGLE_PRIMITIVE,
+    OTHER_PRIMITIVE
+};
+
+struct Primitive_Reference {
+    PRIMITIVE_TYPE type;
+    int index;                      // into the array of that type
+};
+
+struct Flat_BVH_Node {
+    AABB box;
+    int first;                      // leaf: first reference
+    int count;                      // leaf: number of references; 0 for an interior node
+    int second_child;               // interior: index of the right child (the left one is the next node)
+    int axis;                       // interior: split axis
+};
+
+template <typename AABB_Kernel = Default_AABB_Kernel, typename Triangle_Kernel = Default_Triangle_Kernel,
+          typename Sphere_Kernel = Default_Sphere_Kernel>
+class Basic_BVH_Flat : public Primitive {
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    Basic_BVH_Flat(const Primitives_Group &list, double time0 = 0.0, double time1 = 0.0) :
+            Basic_BVH_Flat(list.primitives_list, time0, time1) {}
+
+    Basic_BVH_Flat(const std::vector<std::shared_ptr<Primitive>>& src_objects, double time0 = 0.0, double time1 = 0.0) {
+        // [time0,time1] is the shutter interval; moving primitives are bounded over all of it.
+
+        if (src_objects.empty()) {
+            std::cerr << "CANNOT BUILD A BVH OVER AN EMPTY LIST!\n";
+            exit(0);
+        }
+
+        std::vector<Build_Entry> entries;
+        entries.reserve(src_objects.size());
+        for (const auto& object : src_objects) {
+            Build_Entry e;
+            if (!object->has_bounding_box(time0, time1, e.box)) {
+                std::cerr << "NO BOUNDING BOX";
+                exit(0);
+            }
+            e.centroid = e.box.get_centroid();
+            e.reference = store(object);
+            entries.push_back(e);
+        }
+
+        nodes.reserve(2 * entries.size());
+        build(entries, 0, static_cast<int>(entries.size()));
+
+        references.reserve(entries.size());
+        for (const Build_Entry& e : entries)
+            references.push_back(e.reference);
+    }
+
+    // Overridden Functions
+    // -----------------------------------------------------------------------
+    bool intersection(const Ray &r, double t_0, double t_1, Intersection_Information &intersection_info) const override {
+        int stack[64];
+        int stack_size = 0;
+        int node = 0;
+        bool hit = false;
+
+        while (true) {
+            const Flat_BVH_Node& n = nodes[node];
+            if (n.box.intersection<AABB_Kernel>(r, t_0, t_1)) {
+                if (n.count > 0) {
+                    for (int i = n.first; i < n.first + n.count; i++) {
+                        if (intersect_reference(references[i], r, t_0, t_1, intersection_info)) {
+                            hit = true;
+                            t_1 = intersection_info.t;
+                        }
+                    }
+                } else {
+                    // Visit the child on the ray's side of the split first; the other one goes on the stack
+                    if (r.sign[n.axis]) {
+                        stack[stack_size++] = node + 1;
+                        node = n.second_child;
+                    } else {
+                        stack[stack_size++] = n.second_child;
+                        node = node + 1;
+                    }
+                    continue;
+                }
+            }
+
+            if (stack_size == 0)
+                break;
+            node = stack[--stack_size];
+        }
+
+        return hit;
+    }
+
+    bool has_bounding_box(double time_0, double time_1, AABB &surrounding_AABB) const override {
+        surrounding_AABB = nodes[0].box;
+        return true;
+    }
+
+private:
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    bool intersect_reference(const Primitive_Reference& p, const Ray &r, double t_0, double t_1, Intersection_Information &intersection_info) const {
+        switch (p.type) {
+            case TRIANGLE_PRIMITIVE:
+                return triangles[p.index].intersection(r, t_0, t_1, intersection_info, Triangle_Kernel());
+            case SPHERE_PRIMITIVE:
+                return spheres[p.index].intersection(r, t_0, t_1, intersection_info, Sphere_Kernel());
+            case XY_RECTANGLE_PRIMITIVE:
+                return XY_rectangles[p.index].XY_Rectangle::intersection(r, t_0, t_1, intersection_info);
+            case XZ_RECTANGLE_PRIMITIVE:
+                return XZ_rectangles[p.index].XZ_Rectangle::intersection(r, t_0, t_1, intersection_info);
+            case YZ_RECTANGLE_PRIMITIVE:
+                return YZ_rectangles[p.index].YZ_Rectangle::intersection(r, t_0, t_1, intersection_info);
+            default:
+                return other_primitives[p.index]->intersection(r, t_0, t_1, intersection_info);
+        }
+    }
+
+    Primitive_Reference store(const std::shared_ptr<Primitive>& object) {
+        // Copies the primitive into the array of its type and returns a reference to it
+
+        Primitive_Reference p;
+        if (auto triangle = std::dynamic_pointer_cast<Basic_Triangle<Triangle_Kernel>>(object)) {
+            p.type = TRIANGLE_PRIMITIVE;
+            p.index = static_cast<int>(triangles.size());
+            triangles.push_back(*triangle);
+        } else if (auto sphere = std::dynamic_pointer_cast<Basic_Sphere<Sphere_Kernel>>(object)) {
+            p.type = SPHERE_PRIMITIVE;
+            p.index = static_cast<int>(spheres.size());
+            spheres.push_back(*sphere);
+        } else if (auto rectangle = std::dynamic_pointer_cast<XY_Rectangle>(object)) {
+            p.type = XY_RECTANGLE_PRIMITIVE;
+            p.index = static_cast<int>(XY_rectangles.size());
+            XY_rectangles.push_back(*rectangle);
+        } else if (auto rectangle = std::dynamic_pointer_cast<XZ_Rectangle>(object)) {
+            p.type = XZ_RECTANGLE_PRIMITIVE;
+            p.index = static_cast<int>(XZ_rectangles.size());
+            XZ_rectangles.push_back(*rectangle);
+        } else if (auto rectangle = std::dynamic_pointer_cast<YZ_Rectangle>(object)) {
+            p.type = YZ_RECTANGLE_PRIMITIVE;
+            p.index = static_cast<int>(YZ_rectangles.size());
+            YZ_rectangles.push_back(*rectangle);
+        } else {
+            p.type = OTHER_PRIMITIVE;
+            p.index = static_cast<int>(other_primitives.size());
+            other_primitives.push_back(object);
+        }
+        return p;
+    }
+
+    struct Build_Entry {
+        AABB box;
+        point3D centroid;
+        Primitive_Reference reference;
+    };
+
+    int build(std::vector<Build_Entry>& entries, int begin, int end) {
+        // Median split on the axis along which the centroids spread the most. Returns the node's index.
+
+        int index = static_cast<int>(nodes.size());
+        nodes.push_back(Flat_BVH_Node());
+
+        AABB box = entries[begin].box;
+        point3D centroid_min = entries[begin].centroid;
+        point3D centroid_max = entries[begin].centroid;
+        for (int i = begin + 1; i < end; i++) {
+            box = construct_surrounding_box(box, entries[i].box);
+            centroid_min = min(centroid_min, entries[i].centroid);
+            centroid_max = max(centroid_max, entries[i].centroid);
+        }
+
+        Vec3D extent = centroid_max - centroid_min;
+        int axis = (extent.x() > extent.y() && extent.x() > extent.z()) ? 0 : (extent.y() > extent.z() ? 1 : 2);
+
+        // Leaves hold up to max_leaf_size primitives, or more if their centroids can't be told apart
+        if (end - begin <= max_leaf_size || extent[axis] <= 0.0) {
+            nodes[index].box = box;
+            nodes[index].first = begin;
+            nodes[index].count = end - begin;
+            nodes[index].second_child = -1;
+            nodes[index].axis = axis;
+            return index;
+        }
+
+        int middle = (begin + end) / 2;
+        std::nth_element(entries.begin() + begin, entries.begin() + middle, entries.begin() + end,
+                         [axis](const Build_Entry& a, const Build_Entry& b) { return a.centroid[axis] < b.centroid[axis]; });
+
+        build(entries, begin, middle);
+        int second_child = build(entries, middle, end);
+
+        nodes[index].box = box;
+        nodes[index].first = 0;
+        nodes[index].count = 0;
+        nodes[index].second_child = second_child;
+        nodes[index].axis = axis;
+        return index;
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    static const int max_leaf_size = 4;
+
+    std::vector<Flat_BVH_Node> nodes;                           // nodes[0] is the root
+    std::vector<Primitive_Reference> references;                // leaf contents, indexed by Flat_BVH_Node::first
+    std::vector<Basic_Triangle<Triangle_Kernel>> triangles;
+    std::vector<Basic_Sphere<Sphere_Kernel>> spheres;
+    std::vector<XY_Rectangle> XY_rectangles;
+    std::vector<XZ_Rectangle> XZ_rectangles;
+    std::vector<YZ_Rectangle> YZ_rectangles;
+    std::vector<std::shared_ptr<Primitive>> other_primitives;   // everything else, called virtually
+};
+
+typedef Basic_BVH_Flat<> BVH_Flat;
+
+#endif //CUDA_RAY_TRACER_BVH_FLAT_H
@@ -10,18 +10,19 @@
 #include "../Primitives/Primitives_Group.h"
 
 /// Reference: Fundamentals of Computer Graphics - Section 12.3.2: Hierarchical Bounding Boxes
-class BVH_Max_Coordinate : public Primitive {
+template <typename AABB_Kernel = Default_AABB_Kernel>
+class Basic_BVH_Max_Coordinate : public Primitive {
 public:
     // Constructors
     // -----------------------------------------------------------------------
-    BVH_Max_Coordinate();
+    Basic_BVH_Max_Coordinate();
 
     /// Reference: Fundamentals of Computer Graphics - Section 12.3.2: Hierarchical Bounding Boxes
-    BVH_Max_Coordinate(const Primitives_Group &list) :
-            BVH_Max_Coordinate(list.primitives_list, 0, list.primitives_list.size(), 0.0, 0.0, 0) {}
+    Basic_BVH_Max_Coordinate(const Primitives_Group &list) :
+            Basic_BVH_Max_Coordinate(list.primitives_list, 0, list.primitives_list.size(), 0.0, 0.0, 0) {}
 
     /// Reference: Fundamentals of Computer Graphics - Section 12.3.2: Hierarchical Bounding Boxes
-    BVH_Max_Coordinate(const std::vector<std::shared_ptr<Primitive>> &src_objects,
+    Basic_BVH_Max_Coordinate(const std::vector<std::shared_ptr<Primitive>> &src_objects,
         size_t start, size_t end, double time0, double time1, int axis_ctr) {
         // Strategy: Sort by Max Coordinate.
         // Axis Choice: Rotational.
@@ -64,8 +65,8 @@ public:
             // std::nth_element(objects.begin() + start, objects.begin() + m, objects.begin() + end, comparator);
 
             // Recursively construct the left and right subtrees
-            left = std::make_shared<BVH_Max_Coordinate>(objects, start, m, time0, time1, axis_ctr + 1);
-            right = std::make_shared<BVH_Max_Coordinate>(objects, m, end, time0, time1, axis_ctr + 1);
+            left = std::make_shared<Basic_BVH_Max_Coordinate>(objects, start, m, time0, time1, axis_ctr + 1);
+            right = std::make_shared<Basic_BVH_Max_Coordinate>(objects, m, end, time0, time1, axis_ctr + 1);
         }
 
         AABB box_left, box_right;
@@ -86,7 +87,7 @@ public:
         // Tests whether the box of the BVH node is intersected by the ray r.
 
         /* A faster intersection method [1]. I will stick to this rather than my implementation below. */
-        if (!BBOX.intersection(r, t_0, t_1))
+        if (!BBOX.intersection<AABB_Kernel>(r, t_0, t_1))
             return false;
 
         bool hit_left = left->intersection(r, t_0, t_1, intersection_info);
@@ -96,7 +97,7 @@ public:
 
         /* A slower intersection method [2] */
         /*
-     if (BBOX.intersection(r, t_0, t_1)) {
+     if (BBOX.intersection<AABB_Kernel>(r, t_0, t_1)) {
          Intersection_Information l_rec, r_rec;
 
          bool left_hit = left->intersection(r, t_0, t_1, l_rec);
@@ -132,4 +133,6 @@ public:
     AABB BBOX;         // bounding box
 };
 
+typedef Basic_BVH_Max_Coordinate<> BVH_Max_Coordinate;
+
 #endif //CUDA_RAY_TRACER_BVH_MAX_COORDINATE_H
@@ -0,0 +1,49 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_INTERSECTION_KERNELS_H
+#define CUDA_RAY_TRACER_INTERSECTION_KERNELS_H
+
+// The ray/AABB, ray/triangle and ray/sphere algorithms, as tag types. They are template parameters of the
+// BVHs (Basic_BVH_Fast<AABB_Kernel>, ...), Basic_Triangle<Triangle_Kernel> and Basic_Sphere<Sphere_Kernel>,
+// which pick the matching algorithm by overload resolution on the tag, so the choice is made at compile
+// time and the algorithm is inlined into the caller.
+//
+// BVH_Fast, Triangle, Sphere, etc. are the instantiations with the default kernels below. A deployment
+// selects other defaults without editing code by defining AABB_KERNEL, TRIANGLE_KERNEL and SPHERE_KERNEL
+// (the CMake cache variables of the same names do that), e.g. -DAABB_KERNEL=Tavian_AABB.
+// -----------------------------------------------------------------------
+
+// Ray/AABB
+struct Williams_AABB { static const char* name() { return "williams"; } };
+struct Tavian_AABB { static const char* name() { return "tavian"; } };
+struct Slab_AABB { static const char* name() { return "slab"; } };
+struct Our_AABB { static const char* name() { return "ours"; } };
+struct Kensler_AABB { static const char* name() { return "kensler"; } };
+
+// Ray/triangle
+struct Moller_Trumbore_Triangle { static const char* name() { return "moller_trumbore"; } };
+struct Snyder_Barr_Triangle { static const char* name() { return "snyder_barr"; } };
+
+// Ray/sphere
+struct Algebraic_Sphere { static const char* name() { return "algebraic"; } };
+struct Geometric_Sphere { static const char* name() { return "geometric"; } };
+
+#ifndef AABB_KERNEL
+#define AABB_KERNEL Williams_AABB
+#endif
+
+#ifndef TRIANGLE_KERNEL
+#define TRIANGLE_KERNEL Moller_Trumbore_Triangle
+#endif
+
+#ifndef SPHERE_KERNEL
+#define SPHERE_KERNEL Algebraic_Sphere
+#endif
+
+typedef AABB_KERNEL Default_AABB_Kernel;
+typedef TRIANGLE_KERNEL Default_Triangle_Kernel;
+typedef SPHERE_KERNEL Default_Sphere_Kernel;
+
+#endif //CUDA_RAY_TRACER_INTERSECTION_KERNELS_H
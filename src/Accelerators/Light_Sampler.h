@@ -0,0 +1,362 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_LIGHT_SAMPLER_H
+#define CUDA_RAY_TRACER_LIGHT_SAMPLER_H
+
+#include "../Utilities.h"
+#include "../Primitives/Primitive.h"
+
+enum LIGHT_SAMPLING_STRATEGY {
+    POWER_SAMPLING,             // pick lights by emitted power (alias table), same for every shading point
+    LIGHT_BVH_SAMPLING          // pick lights by power / distance², by walking down the light BVH
+};
+
+/// References:         - Physically Based Rendering (4th ed.) - Section 12.6: Light Sampling
+///                     - Importance Sampling of Many Lights with Adaptive Tree Splitting (Conty & Kulla 2018)
+///                     - A Linear Algorithm for Generating Random Numbers with a Given Distribution (Vose 1991)
+// A replacement for a Primitives_Group of lights, for scenes with many emitters. Primitives_Group picks a
+// light uniformly and evaluates PDF_value() by asking every light, which is O(number of lights) per bounce.
+// Light_Sampler picks lights in O(1) (alias table) or O(log n) (light BVH), and evaluates PDF_value() by
+// tracing the direction through a BVH over the lights, so only the lights that the direction actually
+// hits are asked. Use it as the lights of a scene: Primitives_Group(std::make_shared<Light_Sampler>(...)).
+class Light_Sampler : public Primitive {
+public:
+    // Constructor
+    // -----------------------------------------------------------------------
+    explicit Light_Sampler(LIGHT_SAMPLING_STRATEGY strategy = POWER_SAMPLING) : strategy(strategy) {}
+
+    void add_light(const std::shared_ptr<Primitive>& light, const Color& emitted_radiance = Color(1, 1, 1)) {
+        // Adds a light. Its power is its area times the luminance of what it emits; primitives that
+        // do not know their area are weighted as if their area was 1.
+
+        double area = light->get_area();
+        double power = (area > 0 ? area : 1.0) * luminance(emitted_radiance);
+
+        lights.push_back(light);
+        light_power.push_back(power > 0 ? power : 0.0);
+        built = false;
+    }
+
+    void build() {
+        // Builds the alias table and the light BVH. Must be called after the last add_light(),
+        // before rendering.
+
+        if (lights.empty()) {
+            std::cerr << "LIGHT_SAMPLER: NO LIGHTS WERE ADDED!\n";
+            exit(0);
+        }
+
+        build_alias_table();
+
+        nodes.clear();
+        light_trail.assign(lights.size(), 0);
+        std::vector<int> indices(lights.size());
+        for (size_t i = 0; i < lights.size(); i++)
+            indices[i] = static_cast<int>(i);
+        build_light_BVH(indices, 0, static_cast<int>(indices.size()), 0, 0);
+
+        built = true;
+    }
+
+    // Overridden Functions
+    // -----------------------------------------------------------------------
+    bool intersection(const Ray &r, double t_0, double t_1, Intersection_Information &intersection_info) const override {
+        // Closest light hit by the ray
+
+        ensure_built();
+
+        bool hit = false;
+        int stack[64];
+        int stack_size = 0;
+        stack[stack_size++] = 0;
+
+        while (stack_size > 0) {
+            const Light_BVH_Node& node = nodes[stack[--stack_size]];
+            if (!node.box.intersection(r, t_0, t_1))
+                continue;
+
+            if (node.light_index >= 0) {
+                if (lights[node.light_index]->intersection(r, t_0, t_1, intersection_info)) {
+                    hit = true;
+                    t_1 = intersection_info.t;
+                }
+            } else {
+                stack[stack_size++] = node.child[0];
+                stack[stack_size++] = node.child[1];
+            }
+        }
+
+        return hit;
+    }
+
+    bool has_bounding_box(double time_0, double time_1, AABB &surrounding_AABB) const override {
+        ensure_built();
+        surrounding_AABB = nodes[0].box;
+        return true;
+    }
+
+    double PDF_value(const point3D &o, const Vec3D &v) const override {
+        // The PDF of the direction v is the sum, over the lights that v hits, of the probability of
+        // picking that light times the light's own PDF of v. The lights that v misses contribute 0,
+        // so only the subtrees whose boxes the ray enters are visited.
+
+        ensure_built();
+
+        Ray r(o, v);
+        double sum = 0.0;
+        int stack[64];
+        int stack_size = 0;
+        stack[stack_size++] = 0;
+
+        while (stack_size > 0) {
+            const Light_BVH_Node& node = nodes[stack[--stack_size]];
+            if (!node.box.intersection(r, 0.001, infinity))
+                continue;
+
+            if (node.light_index >= 0) {
+                double light_pdf = lights[node.light_index]->PDF_value(o, v);
+                if (light_pdf > 0)
+                    sum += light_pmf(o, node.light_index) * light_pdf;
+            } else {
+                stack[stack_size++] = node.child[0];
+                stack[stack_size++] = node.child[1];
+            }
+        }
+
+        return sum;
+    }
+
+    Vec3D random(const Vec3D &o) const override {
+        // Picks a light, then a direction towards it
+
+        ensure_built();
+
+        int light_index = (strategy == POWER_SAMPLING) ? sample_alias_table(sample_1D()) : sample_light_BVH(o, sample_1D());
+        if (light_index < 0)
+            return Vec3D(1, 0, 0);
+
+        return lights[light_index]->random(o);
+    }
+
+    double get_area() const override {
+        double area = 0.0;
+        for (const auto& light : lights)
+            area += light->get_area();
+        return area;
+    }
+
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    double light_pmf(const point3D& o, int light_index) const {
+        // Probability of picking the light when sampling from o
+
+        ensure_built();
+
+        if (strategy == POWER_SAMPLING)
+            return light_power[light_index] / total_power;
+
+        // Walk from the root to the light's leaf, following the bits recorded when building
+        double pmf = 1.0;
+        int node_index = 0;
+        uint64_t trail = light_trail[light_index];
+
+        while (nodes[node_index].light_index < 0) {
+            const Light_BVH_Node& node = nodes[node_index];
+            double importance_0 = importance(nodes[node.child[0]], o);
+            double importance_1 = importance(nodes[node.child[1]], o);
+            if (importance_0 + importance_1 <= 0)
+                return 0.0;
+
+            int branch = static_cast<int>(trail & 1);
+            pmf *= (branch ? importance_1 : importance_0) / (importance_0 + importance_1);
+            node_index = node.child[branch];
+            trail >>= 1;
+        }
+
+        return pmf;
+    }
+
+    size_t number_of_lights() const { return lights.size(); }
+
+private:
+    struct Light_BVH_Node {
+        AABB box;                   // bounds of the lights below the node
+        double power;               // their total power
+        int child[2];               // children (inner nodes only)
+        int light_index;            // the light of a leaf, -1 for inner nodes
+    };
+
+    static double luminance(const Color& c) {
+        return 0.2126 * c.x() + 0.7152 * c.y() + 0.0722 * c.z();
+    }
+
+    void ensure_built() const {
+        if (!built) {
+            std::cerr << "LIGHT_SAMPLER: CALL build() AFTER ADDING THE LIGHTS!\n";
+            exit(0);
+        }
+    }
+
+    // Alias Table
+    // -----------------------------------------------------------------------
+    void build_alias_table() {
+        // Vose's method: every bucket holds one light with probability alias_probability[i],
+        // and gives the rest of its 1/n to alias[i]
+
+        int n = static_cast<int>(lights.size());
+        total_power = 0.0;
+        for (double p : light_power)
+            total_power += p;
+        if (total_power <= 0) {
+            // Nothing emits: fall back to uniform sampling
+            std::fill(light_power.begin(), light_power.end(), 1.0);
+            total_power = n;
+        }
+
+        alias_probability.assign(n, 1.0);
+        alias.assign(n, 0);
+
+        std::vector<double> scaled(n);
+        std::vector<int> small, large;
+        for (int i = 0; i < n; i++) {
+            scaled[i] = light_power[i] * n / total_power;
+            (scaled[i] < 1.0 ? small : large).push_back(i);
+        }
+
+        while (!small.empty() && !large.empty()) {
+            int s = small.back(); small.pop_back();
+            int l = large.back(); large.pop_back();
+
+            alias_probability[s] = scaled[s];
+            alias[s] = l;
+
+            scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+            (scaled[l] < 1.0 ? small : large).push_back(l);
+        }
+
+        // What is left is 1 up to rounding errors
+        for (int i : small) { alias_probability[i] = 1.0; alias[i] = i; }
+        for (int i : large) { alias_probability[i] = 1.0; alias[i] = i; }
+    }
+
+    int sample_alias_table(double u) const {
+        int n = static_cast<int>(lights.size());
+        int bucket = std::min(static_cast<int>(u * n), n - 1);
+        double up = u * n - bucket;                 // the rest of u, reused to choose inside the bucket
+
+        return up < alias_probability[bucket] ? bucket : alias[bucket];
+    }
+
+    // Light BVH
+    // -----------------------------------------------------------------------
+    int build_light_BVH(std::vector<int>& indices, int begin, int end, uint64_t trail, int depth) {
+        // Splits the lights at the median of their centroids along the widest axis. trail records
+        // the branches taken from the root (bit k = branch at depth k), so that light_pmf() can find
+        // the path to a light without parent pointers.
+
+        int node_index = static_cast<int>(nodes.size());
+        nodes.push_back(Light_BVH_Node());
+
+        AABB box = light_box(indices[begin]);
+        double power = light_power[indices[begin]];
+        point3D centroid_min = box.get_centroid(), centroid_max = box.get_centroid();
+        for (int i = begin + 1; i < end; i++) {
+            AABB b = light_box(indices[i]);
+            box = construct_surrounding_box(box, b);
+            power += light_power[indices[i]];
+            for (int a = 0; a < 3; a++) {
+                centroid_min[a] = fmin(centroid_min[a], b.get_centroid()[a]);
+                centroid_max[a] = fmax(centroid_max[a], b.get_centroid()[a]);
+            }
+        }
+        nodes[node_index].box = box;
+        nodes[node_index].power = power;
+
+        if (end - begin == 1) {
+            // Leaves hold one light. Median splits keep the depth at log2(n), well within the 64 trail bits.
+            nodes[node_index].light_index = indices[begin];
+            nodes[node_index].child[0] = nodes[node_index].child[1] = -1;
+            light_trail[indices[begin]] = trail;
+            return node_index;
+        }
+
+        Vec3D extent = centroid_max - centroid_min;
+        int axis = (extent.x() > extent.y() && extent.x() > extent.z()) ? 0 : (extent.y() > extent.z() ? 1 : 2);
+        int middle = (begin + end) / 2;
+        std::nth_element(indices.begin() + begin, indices.begin() + middle, indices.begin() + end,
+                         [&](int a, int b) { return light_box(a).get_centroid()[axis] < light_box(b).get_centroid()[axis]; });
+
+        nodes[node_index].light_index = -1;
+        int left = build_light_BVH(indices, begin, middle, trail, depth + 1);
+        int right = build_light_BVH(indices, middle, end, trail | (uint64_t(1) << depth), depth + 1);
+        nodes[node_index].child[0] = left;
+        nodes[node_index].child[1] = right;
+
+        return node_index;
+    }
+
+    AABB light_box(int light_index) const {
+        AABB box;
+        if (!lights[light_index]->has_bounding_box(0, 0, box)) {
+            std::cerr << "LIGHT_SAMPLER: LIGHTS MUST HAVE A BOUNDING BOX!\n";
+            exit(0);
+        }
+        return box;
+    }
+
+    static double importance(const Light_BVH_Node& node, const point3D& p) {
+        // How much the lights below the node may contribute at p: their power over the squared
+        // distance to their center. The distance is clamped to half the box diagonal, so that
+        // points inside or next to the box do not blow up.
+
+        double distance_squared = (node.box.get_centroid() - p).length_squared();
+        double half_diagonal = 0.5 * (node.box.get_max() - node.box.get_min()).length();
+        distance_squared = fmax(distance_squared, half_diagonal * half_diagonal);
+
+        return distance_squared > 0 ? node.power / distance_squared : node.power;
+    }
+
+    int sample_light_BVH(const point3D& p, double u) const {
+        // Walks down the tree choosing each child in proportion to its importance. u is rescaled
+        // at every level so a single sample dimension is enough.
+
+        int node_index = 0;
+        while (nodes[node_index].light_index < 0) {
+            const Light_BVH_Node& node = nodes[node_index];
+            double importance_0 = importance(nodes[node.child[0]], p);
+            double importance_1 = importance(nodes[node.child[1]], p);
+            if (importance_0 + importance_1 <= 0)
+                return -1;
+
+            double p_0 = importance_0 / (importance_0 + importance_1);
+            if (u < p_0) {
+                u = fmin(u / p_0, 1.0 - epsilon);
+                node_index = node.child[0];
+            } else {
+                u = fmin((u - p_0) / (1.0 - p_0), 1.0 - epsilon);
+                node_index = node.child[1];
+            }
+        }
+
+        return nodes[node_index].light_index;
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    LIGHT_SAMPLING_STRATEGY strategy;
+    std::vector<std::shared_ptr<Primitive>> lights;
+    std::vector<double> light_power;                // area * luminance of the emitted radiance
+    double total_power = 0.0;
+
+    std::vector<double> alias_probability;          // alias table
+    std::vector<int> alias;
+
+    std::vector<Light_BVH_Node> nodes;              // light BVH, nodes[0] is the root
+    std::vector<uint64_t> light_trail;              // path from the root to each light's leaf
+
+    bool built = false;
+};
+
+#endif //CUDA_RAY_TRACER_LIGHT_SAMPLER_H
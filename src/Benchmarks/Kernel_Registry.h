@@ -0,0 +1,79 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_KERNEL_REGISTRY_H
+#define CUDA_RAY_TRACER_KERNEL_REGISTRY_H
+
+#include "../Accelerators/BVH_Builders.h"
+#include "../Primitives/Triangle.h"
+#include "../Primitives/Sphere.h"
+
+// Every combination of ray/AABB, ray/triangle and ray/sphere kernel, instantiated once, so the benchmark can
+// pick any of them by name. A combination is a BVH_Build_Function: it rebuilds the scene's triangles and
+// spheres as Basic_Triangle<Triangle_Kernel> / Basic_Sphere<Sphere_Kernel> and builds a BVH traversed with
+// AABB_Kernel. Everything is resolved when the scene is built; rendering pays nothing for the choice.
+//
+// Only primitives that are directly in the world list are rebuilt; a triangle or sphere wrapped in a
+// transform (Translate, Rotate_Y, ...) keeps the default kernel.
+// -----------------------------------------------------------------------
+template <typename Triangle_Kernel, typename Sphere_Kernel>
+std::shared_ptr<Primitive> with_kernels(const std::shared_ptr<Primitive>& primitive) {
+    if (auto triangle = std::dynamic_pointer_cast<Triangle>(primitive))
+        return std::make_shared<Basic_Triangle<Triangle_Kernel>>(triangle->a, triangle->b, triangle->c, triangle->triangle_material);
+    if (auto sphere = std::dynamic_pointer_cast<Sphere>(primitive))
+        return std::make_shared<Basic_Sphere<Sphere_Kernel>>(sphere->center, sphere->radius, sphere->sphere_material);
+    return primitive;
+}
+
+template <typename AABB_Kernel, typename Triangle_Kernel, typename Sphere_Kernel>
+Primitives_Group build_BVH_with_kernels(const Primitives_Group& world, BVH_BUILDER builder, double time0, double time1) {
+    Primitives_Group rebuilt;
+    for (const auto& primitive : world.primitives_list)
+        rebuilt.add_primitive_to_list(with_kernels<Triangle_Kernel, Sphere_Kernel>(primitive));
+
+    return Primitives_Group(make_BVH<AABB_Kernel, Triangle_Kernel, Sphere_Kernel>(rebuilt, builder, time0, time1));
+}
+
+struct Kernel_Combination {
+    const char* AABB_kernel;
+    const char* triangle_kernel;
+    const char* sphere_kernel;
+    BVH_Build_Function build;
+};
+
+template <typename AABB_Kernel, typename Triangle_Kernel>
+void register_sphere_kernels(std::vector<Kernel_Combination>& registry) {
+    registry.push_back({AABB_Kernel::name(), Triangle_Kernel::name(), Algebraic_Sphere::name(),
+                        build_BVH_with_kernels<AABB_Kernel, Triangle_Kernel, Algebraic_Sphere>});
+    registry.push_back({AABB_Kernel::name(), Triangle_Kernel::name(), Geometric_Sphere::name(),
+                        build_BVH_with_kernels<AABB_Kernel, Triangle_Kernel, Geometric_Sphere>});
+}
+
+template <typename AABB_Kernel>
+void register_triangle_kernels(std::vector<Kernel_Combination>& registry) {
+    register_sphere_kernels<AABB_Kernel, Moller_Trumbore_Triangle>(registry);
+    register_sphere_kernels<AABB_Kernel, Snyder_Barr_Triangle>(registry);
+}
+
+inline const std::vector<Kernel_Combination>& kernel_registry() {
+    static std::vector<Kernel_Combination> registry;
+    if (registry.empty()) {
+        register_triangle_kernels<Williams_AABB>(registry);
+        register_triangle_kernels<Tavian_AABB>(registry);
+        register_triangle_kernels<Slab_AABB>(registry);
+        register_triangle_kernels<Our_AABB>(registry);
+        register_triangle_kernels<Kensler_AABB>(registry);
+    }
+    return registry;
+}
+
+inline const Kernel_Combination* find_kernel_combination(const std::string& AABB_kernel, const std::string& triangle_kernel,
+                                                         const std::string& sphere_kernel) {
+    for (const Kernel_Combination& c : kernel_registry())
+        if (AABB_kernel == c.AABB_kernel && triangle_kernel == c.triangle_kernel && sphere_kernel == c.sphere_kernel)
+            return &c;
+    return nullptr;
+}
+
+#endif //CUDA_RAY_TRACER_KERNEL_REGISTRY_H
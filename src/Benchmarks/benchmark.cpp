@@ -0,0 +1,318 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+// Benchmark harness: builds one of the scenes in Scenes.h, renders it with one of the rendering functions,
+// and reports the BVH build time, the render time and the rays traced per second over several repetitions.
+// Scene, renderer, BVH builder, intersection algorithms, thread count and image settings are all picked on
+// the command line, so that runs are comparable without editing main.cpp. Run with --help for the options.
+
+#include "../Rendering/Serial_Rendering_Functions.h"
+#include "../Rendering/Parallel_Rendering_Functions.h"
+#include "../Rendering/Wavefront_Rendering_Functions.h"
+#include "../Rendering/Checkpointed_Rendering_Functions.h"
+#include "Kernel_Registry.h"
+#include "../Scene_Registry.h"
+
+#include <algorithm>
+#include <cstring>
+
+// Registries
+// -----------------------------------------------------------------------
+struct Renderer_Entry {
+    const char* name;
+    void (*render)(Scene_Information&);
+};
+
+static const Renderer_Entry renderers[] = {
+        {"serial", serial_radiance_renderer},
+        {"loop_radiance", parallel_loop_radiance_renderer},
+        {"loop_background", parallel_loop_radiance_background_renderer},
+        {"cols_background", parallel_cols_workload_radiance_background},
+        {"tasks_background", parallel_tasks_radiance_background_renderer},
+        {"loop_mixture", parallel_loop_radiance_mixture_renderer},
+        {"cols_mixture", parallel_cols_workload_radiance_mixture_renderer},
+        {"tasks_mixture", parallel_tasks_radiance_mixture_renderer},
+        {"tiles_mixture", parallel_tiles_radiance_mixture_renderer},
+        {"wavefront_mixture", wavefront_radiance_mixture_renderer},
+        {"wavefront_sorted_mixture", wavefront_sorted_radiance_mixture_renderer},
+        {"checkpointed_mixture", parallel_checkpointed_radiance_mixture_renderer}
+};
+
+// Settings
+// -----------------------------------------------------------------------
+struct Benchmark_Settings {
+    std::string scene = "diffuse_models";
+    std::string renderer = "tasks_mixture";
+    BVH_BUILDER BVH_builder = SCENE_DEFAULT_BVH;
+    std::string AABB_kernel = Default_AABB_Kernel::name();
+    std::string triangle_kernel = Default_Triangle_Kernel::name();
+    std::string sphere_kernel = Default_Sphere_Kernel::name();
+    int threads = 16;
+    THREAD_AFFINITY affinity = AFFINITY_NONE;
+    MEMORY_PLACEMENT placement = PLACEMENT_FIRST_TOUCH;
+    int samples_per_pixel = 0;              // 0 keeps the scene's value (same for width and depth)
+    int image_width = 0;
+    int max_depth = 0;
+    int warmups = 1;
+    int repetitions = 5;
+    std::string format = "csv";
+    std::string output;                     // empty writes the report to stdout
+    std::string image_name = "benchmark_render";
+    bool denoise = false;
+    bool write_AOVs = false;
+    int first_sample = 0;
+    std::string checkpoint_file;            // empty: no checkpoints
+    double checkpoint_interval = 300.0;
+};
+
+struct Summary {
+    double median, p10, p90, min, max, mean;
+};
+
+Summary summarize(std::vector<double> values) {
+    // Percentiles use the nearest-rank method
+
+    std::sort(values.begin(), values.end());
+    auto percentile = [&values](double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * values.size()));
+        return values[rank == 0 ? 0 : rank - 1];
+    };
+
+    Summary s;
+    s.median = percentile(50);
+    s.p10 = percentile(10);
+    s.p90 = percentile(90);
+    s.min = values.front();
+    s.max = values.back();
+    s.mean = 0;
+    for (double v : values)
+        s.mean += v;
+    s.mean /= values.size();
+    return s;
+}
+
+void print_usage() {
+    std::cerr << "Usage: CUDA_Ray_Tracer_Benchmark [options]\n"
+              << "  --scene NAME         " << list_entries(scenes) << ", or a .scene file\n"
+              << "  --renderer NAME      " << list_entries(renderers) << "\n"
+              << "  --bvh NAME           scene_default, bvh, bvh_max_coordinate, bvh_centroid_coordinate, bvh_fast, bvh_parallel, bvh_flat\n"
+              << "  --aabb NAME          williams, tavian, slab, ours, kensler\n"
+              << "  --triangle NAME      moller_trumbore, snyder_barr\n"
+              << "  --sphere NAME        algebraic, geometric\n"
+              << "  --threads N          OpenMP threads used by the parallel renderers (default 16)\n"
+              << "  --affinity NAME      none, compact, spread: how the render threads are pinned to the NUMA nodes' CPUs (default none)\n"
+              << "  --placement NAME     first_touch, interleave, replicate: where the scene and its BVH are put in memory (default first_touch)\n"
+              << "  --spp N              samples per pixel (default: the scene's)\n"
+              << "  --width N            image width; the height follows the scene's aspect ratio (default: the scene's)\n"
+              << "  --depth N            maximum ray depth (default: the scene's)\n"
+              << "  --warmups N          untimed runs before measuring (default 1)\n"
+              << "  --repetitions N      timed runs (default 5)\n"
+              << "  --format csv|json    report format (default csv)\n"
+              << "  --output FILE        write the report to FILE instead of stdout\n"
+              << "  --image NAME         name of the rendered .ppm (default benchmark_render)\n"
+              << "  --denoise on|off     run the a-trous denoiser on the framebuffer (default off)\n"
+              << "  --aovs on|off        also write the albedo, normal and depth AOVs next to the image (default off)\n"
+              << "  --checkpoint FILE    checkpointed_mixture: save to / resume from FILE, and checkpoint on SIGINT/SIGTERM\n"
+              << "  --checkpoint-interval SECONDS   seconds between checkpoints (default 300)\n"
+              << "  --first-sample N     checkpointed_mixture: index of the first sample of every pixel (default 0)\n";
+}
+
+bool parse_arguments(int argc, char** argv, Benchmark_Settings& settings) {
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (option == "--help" || option == "-h")
+            return false;
+        if (i + 1 >= argc) {
+            std::cerr << "MISSING VALUE FOR " << option << "\n";
+            return false;
+        }
+        std::string value = argv[++i];
+
+        bool ok = true;
+        if (option == "--scene") settings.scene = value;
+        else if (option == "--renderer") settings.renderer = value;
+        else if (option == "--bvh") ok = parse_BVH_builder(value, settings.BVH_builder);
+        else if (option == "--aabb") settings.AABB_kernel = value;
+        else if (option == "--triangle") settings.triangle_kernel = value;
+        else if (option == "--sphere") settings.sphere_kernel = value;
+        else if (option == "--threads") settings.threads = std::atoi(value.c_str());
+        else if (option == "--affinity") ok = parse_thread_affinity(value, settings.affinity);
+        else if (option == "--placement") ok = parse_memory_placement(value, settings.placement);
+        else if (option == "--spp") settings.samples_per_pixel = std::atoi(value.c_str());
+        else if (option == "--width") settings.image_width = std::atoi(value.c_str());
+        else if (option == "--depth") settings.max_depth = std::atoi(value.c_str());
+        else if (option == "--warmups") settings.warmups = std::atoi(value.c_str());
+        else if (option == "--repetitions") settings.repetitions = std::atoi(value.c_str());
+        else if (option == "--format") { settings.format = value; ok = (value == "csv" || value == "json"); }
+        else if (option == "--output") settings.output = value;
+        else if (option == "--image") settings.image_name = value;
+        else if (option == "--denoise") { settings.denoise = (value == "on"); ok = (value == "on" || value == "off"); }
+        else if (option == "--checkpoint") settings.checkpoint_file = value;
+        else if (option == "--first-sample") settings.first_sample = std::atoi(value.c_str());
+        else if (option == "--checkpoint-interval") settings.checkpoint_interval = std::atof(value.c_str());
+        else if (option == "--aovs") { settings.write_AOVs = (value == "on"); ok = (value == "on" || value == "off"); }
+        else ok = false;
+
+        if (!ok) {
+            std::cerr << "INVALID OPTION OR VALUE: " << option << " " << value << "\n";
+            return false;
+        }
+    }
+
+    if (!scene_exists(settings.scene)) {
+        std::cerr << "UNKNOWN SCENE: " << settings.scene << "\n";
+        return false;
+    }
+    if (!find_entry(renderers, settings.renderer)) {
+        std::cerr << "UNKNOWN RENDERER: " << settings.renderer << "\n";
+        return false;
+    }
+    if (!find_kernel_combination(settings.AABB_kernel, settings.triangle_kernel, settings.sphere_kernel)) {
+        std::cerr << "UNKNOWN KERNEL COMBINATION: " << settings.AABB_kernel << " " << settings.triangle_kernel
+                  << " " << settings.sphere_kernel << "\n";
+        return false;
+    }
+    if (settings.threads < 1 || settings.repetitions < 1 || settings.warmups < 0) {
+        std::cerr << "THREADS AND REPETITIONS MUST BE POSITIVE!\n";
+        return false;
+    }
+    return true;
+}
+
+// Measurement
+// -----------------------------------------------------------------------
+struct Run_Result {
+    double BVH_build_time;
+    double render_time;
+    double mega_rays_per_second;
+    long long rays;
+};
+
+Run_Result run_once(const Benchmark_Settings& settings) {
+    // Builds the scene from scratch (so the BVH build is measured too) and renders it once.
+    // The scenes and renderers print progress on std::cout; that is silenced while running.
+
+    std::streambuf* cout_buffer = std::cout.rdbuf(nullptr);
+
+    accumulated_BVH_build_time() = 0.0;
+    Scene_Information scene_info;
+    if (settings.placement == PLACEMENT_INTERLEAVE) {
+        Interleaved_Memory_Scope interleave;
+        scene_info = build_scene(settings.scene);
+    } else {
+        scene_info = build_scene(settings.scene);
+    }
+    double BVH_build_time = accumulated_BVH_build_time();
+
+    if (settings.image_width > 0) {
+        scene_info.image_width = settings.image_width;
+        scene_info.image_height = static_cast<int>(scene_info.image_width / scene_info.aspect_ratio);
+    }
+    if (settings.samples_per_pixel > 0)
+        scene_info.samples_per_pixel = settings.samples_per_pixel;
+    if (settings.max_depth > 0)
+        scene_info.max_depth = settings.max_depth;
+    scene_info.number_of_threads_used = settings.threads;
+    scene_info.output_image_name = settings.image_name;
+    scene_info.denoiser.denoise = settings.denoise;
+    scene_info.denoiser.write_AOVs = settings.write_AOVs;
+    scene_info.first_sample = settings.first_sample;
+    scene_info.checkpoint.enabled = !settings.checkpoint_file.empty();
+    scene_info.checkpoint.file = settings.checkpoint_file;
+    scene_info.checkpoint.interval = settings.checkpoint_interval;
+
+    reset_ray_counters();
+    find_entry(renderers, settings.renderer)->render(scene_info);
+    long long rays = scene_info.rays_traced;
+
+    std::cout.rdbuf(cout_buffer);
+
+    Run_Result result;
+    result.BVH_build_time = BVH_build_time;
+    result.render_time = scene_info.render_time;
+    result.rays = rays;
+    result.mega_rays_per_second = rays / scene_info.render_time / 1e6;
+    return result;
+}
+
+void write_report(std::ostream& out, const Benchmark_Settings& settings, const std::vector<Run_Result>& runs) {
+    std::vector<double> build_times, render_times, mrays;
+    for (const Run_Result& run : runs) {
+        build_times.push_back(run.BVH_build_time);
+        render_times.push_back(run.render_time);
+        mrays.push_back(run.mega_rays_per_second);
+    }
+
+    const char* metric_names[] = {"BVH_build_time_s", "render_time_s", "mega_rays_per_second"};
+    Summary summaries[] = {summarize(build_times), summarize(render_times), summarize(mrays)};
+
+    if (settings.format == "csv") {
+        out << "scene,renderer,bvh,aabb,triangle,sphere,math,threads,affinity,placement,numa_nodes,repetitions,metric,median,p10,p90,min,max,mean\n";
+        for (int m = 0; m < 3; m++) {
+            const Summary& s = summaries[m];
+            out << settings.scene << ',' << settings.renderer << ',' << BVH_builder_name(settings.BVH_builder) << ','
+                << settings.AABB_kernel << ',' << settings.triangle_kernel << ',' << settings.sphere_kernel << ','
+                << Default_Math::name() << ',' << settings.threads << ',' << thread_affinity_name(settings.affinity) << ','
+                << memory_placement_name(settings.placement) << ',' << NUMA_topology().number_of_nodes() << ','
+                << runs.size() << ',' << metric_names[m] << ','
+                << s.median << ',' << s.p10 << ',' << s.p90 << ',' << s.min << ',' << s.max << ',' << s.mean << '\n';
+        }
+        return;
+    }
+
+    out << "{\n"
+        << "  \"scene\": \"" << settings.scene << "\",\n"
+        << "  \"renderer\": \"" << settings.renderer << "\",\n"
+        << "  \"bvh\": \"" << BVH_builder_name(settings.BVH_builder) << "\",\n"
+        << "  \"aabb\": \"" << settings.AABB_kernel << "\",\n"
+        << "  \"triangle\": \"" << settings.triangle_kernel << "\",\n"
+        << "  \"sphere\": \"" << settings.sphere_kernel << "\",\n"
+        << "  \"math\": \"" << Default_Math::name() << "\",\n"
+        << "  \"threads\": " << settings.threads << ",\n"
+        << "  \"affinity\": \"" << thread_affinity_name(settings.affinity) << "\",\n"
+        << "  \"placement\": \"" << memory_placement_name(settings.placement) << "\",\n"
+        << "  \"numa_nodes\": " << NUMA_topology().number_of_nodes() << ",\n"
+        << "  \"repetitions\": " << runs.size() << ",\n"
+        << "  \"rays_per_run\": " << runs.front().rays << ",\n";
+    for (int m = 0; m < 3; m++) {
+        const Summary& s = summaries[m];
+        out << "  \"" << metric_names[m] << "\": {\"median\": " << s.median << ", \"p10\": " << s.p10
+            << ", \"p90\": " << s.p90 << ", \"min\": " << s.min << ", \"max\": " << s.max
+            << ", \"mean\": " << s.mean << "}" << (m < 2 ? "," : "") << "\n";
+    }
+    out << "}\n";
+}
+
+int main(int argc, char** argv) {
+    Benchmark_Settings settings;
+    if (!parse_arguments(argc, argv, settings)) {
+        print_usage();
+        return 1;
+    }
+
+    // Scenes build their BVH through build_BVH(), which hands it to the selected kernel combination
+    BVH_build_function() = find_kernel_combination(settings.AABB_kernel, settings.triangle_kernel, settings.sphere_kernel)->build;
+    BVH_builder_override() = settings.BVH_builder;
+    replicate_BVH_per_NUMA_node() = (settings.placement == PLACEMENT_REPLICATE);
+    pin_render_threads(settings.affinity, settings.threads);
+
+    for (int i = 0; i < settings.warmups; i++)
+        run_once(settings);
+
+    std::vector<Run_Result> runs;
+    for (int i = 0; i < settings.repetitions; i++) {
+        runs.push_back(run_once(settings));
+        std::cerr << "Repetition " << i + 1 << "/" << settings.repetitions << ": render "
+                  << runs.back().render_time << " s, " << runs.back().mega_rays_per_second << " Mrays/s\n";
+    }
+
+    if (settings.output.empty()) {
+        write_report(std::cout, settings, runs);
+    } else {
+        std::ofstream out(settings.output);
+        write_report(out, settings, runs);
+    }
+
+    return 0;
+}
@@ -0,0 +1,370 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+// Microbenchmarks for the intersection kernels: the five ray/AABB algorithms in AABB, Moller-Trumbore and
+// Snyder-Barr in Triangle, the algebraic and geometric solutions in Sphere, and the XY_Rectangle test.
+//
+// Each kernel is timed on the same recorded rays. Rays are drawn once, from a fixed seed, out of three
+// distributions (primary rays from a pinhole camera, diffuse bounces leaving the surrounding walls, and
+// shadow rays from the walls towards an area light), and are kept or dropped until the reference kernel
+// of each primitive hits exactly the requested fraction of them. The kernels are called directly (member
+// function pointers as template arguments) so the loop measures the kernel and not a dispatch.
+//
+// Every kernel's hit/miss and hit distance is also cross-checked against the reference kernel.
+
+#include "../Utilities.h"
+#include "../Accelerators/AABB.h"
+#include "../Primitives/Triangle.h"
+#include "../Primitives/Sphere.h"
+#include "../Primitives/XY_Rectangle.h"
+#include "../Materials/Diffuse.h"
+
+#include <random>
+#include <algorithm>
+
+// Recorded Rays
+// -----------------------------------------------------------------------
+struct Test_Ray {
+    Ray ray;
+    double t_min;
+    double t_max;
+};
+
+enum RAY_DISTRIBUTION {
+    PRIMARY_RAYS,
+    DIFFUSE_RAYS,
+    SHADOW_RAYS
+};
+
+const char* distribution_name(RAY_DISTRIBUTION d) {
+    switch (d) {
+        case PRIMARY_RAYS: return "primary";
+        case DIFFUSE_RAYS: return "diffuse";
+        case SHADOW_RAYS: return "shadow";
+    }
+    return "?";
+}
+
+class Ray_Generator {
+public:
+    // Constructor
+    // -----------------------------------------------------------------------
+    explicit Ray_Generator(unsigned int seed) : engine(seed), uniform(0.0, 1.0) {}
+
+    // All primitives sit around the origin, inside [-1,1]^3. The "room" around them is a box [-3,3]^3
+    // with a 1x1 area light in its ceiling.
+    Test_Ray generate(RAY_DISTRIBUTION d) {
+        Test_Ray tr;
+        if (d == PRIMARY_RAYS) {
+            // Pinhole camera at (0,0,5) looking down -z, with a field of view of about 53 degrees
+            point3D eye(0, 0, 5);
+            Vec3D direction(2 * u() - 1, 2 * u() - 1, -2);
+            tr.ray = Ray(eye, direction);
+            tr.t_min = 0.001;
+            tr.t_max = infinity;
+        } else {
+            point3D origin;
+            Vec3D normal;
+            point_on_walls(origin, normal);
+
+            if (d == DIFFUSE_RAYS) {
+                tr.ray = Ray(origin, ONB(normal).to_world(cosine_direction()));
+                tr.t_min = 0.001;
+                tr.t_max = infinity;
+            } else {
+                // Unnormalized direction towards a point on the light, so the light sits at t = 1
+                point3D on_light(u() - 0.5, 3.0, u() - 0.5);
+                tr.ray = Ray(origin, on_light - origin);
+                tr.t_min = 0.001;
+                tr.t_max = 0.999;
+            }
+        }
+        return tr;
+    }
+
+private:
+    double u() { return uniform(engine); }
+
+    Vec3D cosine_direction() {
+        double r1 = u();
+        double r2 = u();
+        double phi = 2 * M_PI * r1;
+        return Vec3D(cos(phi) * sqrt(r2), sin(phi) * sqrt(r2), sqrt(1 - r2));
+    }
+
+    void point_on_walls(point3D& p, Vec3D& normal) {
+        // A point on the floor or on one of the four side walls, with the normal pointing inwards
+
+        int wall = static_cast<int>(u() * 5);
+        double a = 6 * u() - 3;
+        double b = 6 * u() - 3;
+        switch (wall) {
+            case 0: p = point3D(a, -3, b); normal = Vec3D(0, 1, 0); break;
+            case 1: p = point3D(-3, a, b); normal = Vec3D(1, 0, 0); break;
+            case 2: p = point3D(3, a, b); normal = Vec3D(-1, 0, 0); break;
+            case 3: p = point3D(a, b, -3); normal = Vec3D(0, 0, 1); break;
+            default: p = point3D(a, b, 3); normal = Vec3D(0, 0, -1); break;
+        }
+    }
+
+    std::mt19937_64 engine;
+    std::uniform_real_distribution<double> uniform;
+};
+
+// Kernels
+// -----------------------------------------------------------------------
+// Each kernel is a small function object returning hit/miss and, where the algorithm computes one, the
+// hit distance t (AABB tests don't, so they report t = 0).
+
+template <bool (AABB::*method)(const Ray&, double, double) const>
+struct AABB_Kernel {
+    AABB box;
+
+    static const bool reports_t = false;    // the AABB tests only answer hit or miss
+
+    bool operator()(const Test_Ray& tr, double& t) const {
+        t = 0.0;
+        return (box.*method)(tr.ray, tr.t_min, tr.t_max);
+    }
+};
+
+template <bool (Triangle::*method)(const Ray&, double, double, Intersection_Information&) const>
+struct Triangle_Kernel {
+    Triangle triangle;
+    static const bool reports_t = true;
+
+    bool operator()(const Test_Ray& tr, double& t) const {
+        Intersection_Information info{};
+        bool hit = (triangle.*method)(tr.ray, tr.t_min, tr.t_max, info);
+        t = hit ? info.t : 0.0;
+        return hit;
+    }
+};
+
+template <bool (Sphere::*method)(const Ray&, double, double, Intersection_Information&) const>
+struct Sphere_Kernel {
+    Sphere sphere;
+    static const bool reports_t = true;
+
+    bool operator()(const Test_Ray& tr, double& t) const {
+        Intersection_Information info{};
+        bool hit = (sphere.*method)(tr.ray, tr.t_min, tr.t_max, info);
+        t = hit ? info.t : 0.0;
+        return hit;
+    }
+};
+
+struct XY_Rectangle_Kernel {
+    XY_Rectangle rectangle;
+    static const bool reports_t = true;
+
+    bool operator()(const Test_Ray& tr, double& t) const {
+        Intersection_Information info{};
+        bool hit = rectangle.XY_Rectangle::intersection(tr.ray, tr.t_min, tr.t_max, info);
+        t = hit ? info.t : 0.0;
+        return hit;
+    }
+};
+
+struct Rectangle_As_Triangles_Kernel {
+    // Cross-check for XY_Rectangle: the same rectangle split into two triangles
+
+    Triangle lower;
+    Triangle upper;
+    static const bool reports_t = true;
+
+    bool operator()(const Test_Ray& tr, double& t) const {
+        Intersection_Information info{};
+        bool hit = lower.Moller_Trumbore_ray_triangle_intersection(tr.ray, tr.t_min, tr.t_max, info) ||
+                   upper.Moller_Trumbore_ray_triangle_intersection(tr.ray, tr.t_min, tr.t_max, info);
+        t = hit ? info.t : 0.0;
+        return hit;
+    }
+};
+
+// Measurement
+// -----------------------------------------------------------------------
+struct Kernel_Result {
+    double ns_per_test;
+    double hit_ratio;
+    int mismatches;
+};
+
+static volatile long long sink;         // keeps the timed loops from being optimized away
+
+template <typename Kernel>
+Kernel_Result measure(const Kernel& kernel, const std::vector<Test_Ray>& rays, const std::vector<bool>& reference_hits,
+                      const std::vector<double>& reference_t, double min_time, int repetitions) {
+    Kernel_Result result;
+
+    // Cross-check against the reference kernel: hit/miss must agree, and so must t when both report one
+    int hits = 0;
+    result.mismatches = 0;
+    for (size_t i = 0; i < rays.size(); i++) {
+        double t = 0.0;
+        bool hit = kernel(rays[i], t);
+        hits += hit;
+        bool compare_t = Kernel::reports_t && hit && reference_hits[i];
+        bool same_t = !compare_t || fabs(t - reference_t[i]) <= 1e-9 * fmax(1.0, fabs(t));
+        if (hit != reference_hits[i] || !same_t)
+            result.mismatches++;
+    }
+    result.hit_ratio = static_cast<double>(hits) / rays.size();
+
+    // Timing: repeat passes over the rays for at least min_time, keep the median over the repetitions
+    std::vector<double> ns;
+    for (int r = 0; r < repetitions; r++) {
+        long long tests = 0;
+        long long count = 0;
+        double start = omp_get_wtime();
+        double elapsed;
+        do {
+            for (const Test_Ray& tr : rays) {
+                double t;
+                count += kernel(tr, t);
+            }
+            tests += rays.size();
+            elapsed = omp_get_wtime() - start;
+        } while (elapsed < min_time);
+        sink = sink + count;
+        ns.push_back(elapsed * 1e9 / tests);
+    }
+    std::sort(ns.begin(), ns.end());
+    result.ns_per_test = ns[ns.size() / 2];
+
+    return result;
+}
+
+template <typename Kernel>
+std::vector<Test_Ray> record_rays(const Kernel& reference, RAY_DISTRIBUTION d, int n, double hit_ratio, unsigned int seed) {
+    // Draws rays from the distribution and keeps exactly round(n*hit_ratio) that the reference kernel hits
+    // and the rest that it misses, then shuffles them so hits and misses are interleaved
+
+    Ray_Generator generator(seed);
+    int wanted_hits = static_cast<int>(n * hit_ratio + 0.5);
+    int wanted_misses = n - wanted_hits;
+
+    std::vector<Test_Ray> rays;
+    long long attempts = 0;
+    while (wanted_hits > 0 || wanted_misses > 0) {
+        if (++attempts > 1000LL * n) {
+            std::cerr << "COULD NOT RECORD " << distribution_name(d) << " RAYS WITH HIT RATIO " << hit_ratio << "\n";
+            exit(0);
+        }
+
+        Test_Ray tr = generator.generate(d);
+        double t = 0.0;
+        bool hit = reference(tr, t);
+        if (hit && wanted_hits > 0) {
+            rays.push_back(tr);
+            wanted_hits--;
+        } else if (!hit && wanted_misses > 0) {
+            rays.push_back(tr);
+            wanted_misses--;
+        }
+    }
+
+    std::shuffle(rays.begin(), rays.end(), std::mt19937(seed));
+    return rays;
+}
+
+struct Benchmark_Settings {
+    int rays = 1 << 16;
+    double hit_ratio = 0.5;
+    double min_time = 0.1;                  // seconds per repetition
+    int repetitions = 5;
+    unsigned int seed = 2026;
+};
+
+template <typename Reference, typename Kernel>
+void run_kernel(const char* primitive, const char* kernel_name, const Reference& reference, const Kernel& kernel,
+                const Benchmark_Settings& settings) {
+    for (int d = PRIMARY_RAYS; d <= SHADOW_RAYS; d++) {
+        RAY_DISTRIBUTION distribution = static_cast<RAY_DISTRIBUTION>(d);
+        std::vector<Test_Ray> rays = record_rays(reference, distribution, settings.rays, settings.hit_ratio, settings.seed + d);
+
+        std::vector<bool> reference_hits(rays.size());
+        std::vector<double> reference_t(rays.size());
+        for (size_t i = 0; i < rays.size(); i++) {
+            double t = 0.0;
+            reference_hits[i] = reference(rays[i], t);
+            reference_t[i] = t;
+        }
+
+        Kernel_Result r = measure(kernel, rays, reference_hits, reference_t, settings.min_time, settings.repetitions);
+        std::cout << primitive << ',' << kernel_name << ',' << distribution_name(distribution) << ','
+                  << r.hit_ratio << ',' << r.ns_per_test << ',' << 1e3 / r.ns_per_test << ',' << r.mismatches << '\n';
+    }
+}
+
+void print_usage() {
+    std::cerr << "Usage: CUDA_Ray_Tracer_Intersection_Benchmark [options]\n"
+              << "  --rays N          recorded rays per distribution (default 65536)\n"
+              << "  --hit-ratio R     fraction of the rays that hit the primitive, in [0,1] (default 0.5)\n"
+              << "  --min-time S      seconds per timed repetition (default 0.1)\n"
+              << "  --repetitions N   timed repetitions; the median is reported (default 5)\n"
+              << "  --seed N          seed of the recorded rays (default 2026)\n";
+}
+
+int main(int argc, char** argv) {
+    Benchmark_Settings settings;
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (i + 1 >= argc || option == "--help") {
+            print_usage();
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (option == "--rays") settings.rays = std::atoi(value.c_str());
+        else if (option == "--hit-ratio") settings.hit_ratio = std::atof(value.c_str());
+        else if (option == "--min-time") settings.min_time = std::atof(value.c_str());
+        else if (option == "--repetitions") settings.repetitions = std::atoi(value.c_str());
+        else if (option == "--seed") settings.seed = static_cast<unsigned int>(std::atoi(value.c_str()));
+        else {
+            print_usage();
+            return 1;
+        }
+    }
+    if (settings.rays < 1 || settings.repetitions < 1 || settings.hit_ratio < 0 || settings.hit_ratio > 1) {
+        print_usage();
+        return 1;
+    }
+
+    auto material = std::make_shared<Diffuse>(Color(0.5, 0.5, 0.5));
+
+    std::cout << "primitive,kernel,distribution,hit_ratio,ns_per_test,Mtests_per_s,mismatches\n";
+
+    // Ray/AABB: reference is the slab method
+    AABB box(point3D(-1, -1, -1), point3D(1, 1, 1));
+    AABB_Kernel<&AABB::slab_method> slab = {box};
+    run_kernel("AABB", "slab", slab, slab, settings);
+    run_kernel("AABB", "tavian", slab, AABB_Kernel<&AABB::Tavian_ray_AABB_intersection>{box}, settings);
+    run_kernel("AABB", "ours", slab, AABB_Kernel<&AABB::our_ray_AABB_intersection>{box}, settings);
+    run_kernel("AABB", "kensler", slab, AABB_Kernel<&AABB::Kensler_ray_AABB_intersection_method>{box}, settings);
+    run_kernel("AABB", "williams", slab, AABB_Kernel<&AABB::Williams_ray_AABB_intersection>{box}, settings);
+
+    // Ray/triangle: reference is Moller-Trumbore
+    Triangle triangle(point3D(-1, -1, 0.2), point3D(1, -0.8, -0.3), point3D(0.1, 1, 0.1), material);
+    Triangle_Kernel<&Triangle::Moller_Trumbore_ray_triangle_intersection> moller_trumbore = {triangle};
+    run_kernel("triangle", "moller_trumbore", moller_trumbore, moller_trumbore, settings);
+    run_kernel("triangle", "snyder_barr", moller_trumbore,
+               Triangle_Kernel<&Triangle::Snyder_Barr_ray_triangle_intersection>{triangle}, settings);
+
+    // Ray/sphere: reference is the algebraic solution
+    Sphere sphere(point3D(0, 0, 0), 1.0, material);
+    Sphere_Kernel<&Sphere::ray_sphere_intersection_algebraic_solution> algebraic = {sphere};
+    run_kernel("sphere", "algebraic", algebraic, algebraic, settings);
+    run_kernel("sphere", "geometric", algebraic,
+               Sphere_Kernel<&Sphere::ray_sphere_intersection_geometric_solution>{sphere}, settings);
+
+    // Ray/rectangle: XY_Rectangle is its own reference; the two-triangle version is the cross-check
+    XY_Rectangle_Kernel rectangle = {XY_Rectangle(point3D(-1, -1, 0), point3D(1, 1, 0), material)};
+    Rectangle_As_Triangles_Kernel as_triangles = {
+            Triangle(point3D(-1, -1, 0), point3D(1, -1, 0), point3D(1, 1, 0), material),
+            Triangle(point3D(-1, -1, 0), point3D(1, 1, 0), point3D(-1, 1, 0), material)};
+    run_kernel("rectangle", "xy_rectangle", rectangle, rectangle, settings);
+    run_kernel("rectangle", "two_triangles", rectangle, as_triangles, settings);
+
+    return 0;
+}
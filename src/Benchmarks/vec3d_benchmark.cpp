@@ -0,0 +1,138 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+// Microbenchmarks for Vec3D: ns per operation of the vector operations the renderers use most, over arrays
+// of vectors large enough to leave L1 but small enough to stay in L2. CMake builds this file twice, as
+// CUDA_Ray_Tracer_Vec3D_Benchmark (the scalar Vec3D) and as CUDA_Ray_Tracer_Vec3D_Benchmark_SIMD (with
+// VEC3D_SIMD, see Mathematics/Vec3D_SIMD.h); run both to compare. Every operation also prints a checksum
+// of its results, which must be the same for both builds: the SIMD operators round like the scalar ones.
+
+#include "../Utilities.h"
+
+#include <random>
+#include <algorithm>
+
+// Operations
+// -----------------------------------------------------------------------
+// Each operation reads a[i] (and b[i]) and writes out[i]; the small ones are combined the way the
+// renderers combine them (reflection, an ONB basis vector, a ray point).
+
+struct Add { Vec3D operator()(const Vec3D& a, const Vec3D& b) const { return a + b; } };
+
+struct Multiply_Add { Vec3D operator()(const Vec3D& a, const Vec3D& b) const { return a + 0.75 * b; } };
+
+struct Hadamard { Vec3D operator()(const Vec3D& a, const Vec3D& b) const { return a * b; } };
+
+struct Dot { Vec3D operator()(const Vec3D& a, const Vec3D& b) const { return Vec3D(dot_product(a, b), 0, 0); } };
+
+struct Cross { Vec3D operator()(const Vec3D& a, const Vec3D& b) const { return cross_product(a, b); } };
+
+struct Unit { Vec3D operator()(const Vec3D& a, const Vec3D&) const { return unit_vector(a); } };
+
+struct Reflect { Vec3D operator()(const Vec3D& v, const Vec3D& n) const { return v - 2 * dot_product(v, n) * n; } };
+
+struct Min_Max { Vec3D operator()(const Vec3D& a, const Vec3D& b) const { return max(a, b) - min(a, b); } };
+
+struct Orthonormal {
+    // The third axis of the ONB built around a, as ONB does
+    Vec3D operator()(const Vec3D& a, const Vec3D&) const {
+        Vec3D w = unit_vector(a);
+        Vec3D helper = (fabs(w.x()) > 0.9) ? Vec3D(0, 1, 0) : Vec3D(1, 0, 0);
+        Vec3D v = unit_vector(cross_product(w, helper));
+        return cross_product(w, v);
+    }
+};
+
+// Measurement
+// -----------------------------------------------------------------------
+struct Benchmark_Settings {
+    int vectors = 1 << 12;
+    double min_time = 0.1;                  // seconds per repetition
+    int repetitions = 5;
+    unsigned int seed = 2026;
+};
+
+template <typename Operation>
+void run_operation(const char* name, const std::vector<Vec3D>& a, const std::vector<Vec3D>& b, const Benchmark_Settings& settings) {
+    std::vector<Vec3D> out(a.size());
+    Operation operation;
+    const size_t n = a.size();
+
+    std::vector<double> ns;
+    for (int r = 0; r < settings.repetitions; r++) {
+        long long operations = 0;
+        double start = omp_get_wtime();
+        double elapsed;
+        do {
+            for (size_t i = 0; i < n; i++)
+                out[i] = operation(a[i], b[i]);
+            operations += n;
+            elapsed = omp_get_wtime() - start;
+        } while (elapsed < settings.min_time);
+        ns.push_back(elapsed * 1e9 / operations);
+    }
+    std::sort(ns.begin(), ns.end());
+
+    double checksum = 0.0;
+    for (const Vec3D& v : out)
+        checksum += v.x() + 2 * v.y() + 3 * v.z();
+
+    std::cout << Vec3D_backend_name() << ',' << name << ',' << ns[ns.size() / 2] << ','
+              << 1e3 / ns[ns.size() / 2] << ',' << checksum << '\n';
+}
+
+void print_usage() {
+    std::cerr << "Usage: CUDA_Ray_Tracer_Vec3D_Benchmark[_SIMD] [options]\n"
+              << "  --vectors N       vectors per array (default 4096)\n"
+              << "  --min-time S      seconds per timed repetition (default 0.1)\n"
+              << "  --repetitions N   timed repetitions; the median is reported (default 5)\n"
+              << "  --seed N          seed of the vectors (default 2026)\n";
+}
+
+int main(int argc, char** argv) {
+    Benchmark_Settings settings;
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (i + 1 >= argc || option == "--help") {
+            print_usage();
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (option == "--vectors") settings.vectors = std::atoi(value.c_str());
+        else if (option == "--min-time") settings.min_time = std::atof(value.c_str());
+        else if (option == "--repetitions") settings.repetitions = std::atoi(value.c_str());
+        else if (option == "--seed") settings.seed = static_cast<unsigned int>(std::atoi(value.c_str()));
+        else {
+            print_usage();
+            return 1;
+        }
+    }
+    if (settings.vectors < 1 || settings.repetitions < 1) {
+        print_usage();
+        return 1;
+    }
+
+    std::mt19937_64 engine(settings.seed);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<Vec3D> a(settings.vectors), b(settings.vectors);
+    for (int i = 0; i < settings.vectors; i++) {
+        a[i] = Vec3D(uniform(engine), uniform(engine), uniform(engine));
+        b[i] = unit_vector(Vec3D(uniform(engine), uniform(engine), uniform(engine)));
+    }
+
+    std::cout << "backend,operation,ns_per_operation,Moperations_per_s,checksum\n";
+    std::cout.precision(17);
+
+    run_operation<Add>("add", a, b, settings);
+    run_operation<Multiply_Add>("multiply_add", a, b, settings);
+    run_operation<Hadamard>("hadamard", a, b, settings);
+    run_operation<Dot>("dot_product", a, b, settings);
+    run_operation<Cross>("cross_product", a, b, settings);
+    run_operation<Unit>("unit_vector", a, b, settings);
+    run_operation<Reflect>("reflect", a, b, settings);
+    run_operation<Min_Max>("min_max", a, b, settings);
+    run_operation<Orthonormal>("onb_axis", a, b, settings);
+
+    return 0;
+}
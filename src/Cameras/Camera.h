@@ -7,7 +7,10 @@
 
 #include "../Utilities.h"
 
-/// Reference: Ray Tracing in One Weekend
+/// References:         - Ray Tracing in One Weekend - Section 13: Defocus Blur
+///                     - Ray Tracing: The Next Week - Section 2: Motion Blur
+// A thin-lens camera. With the default aperture (0) and focus distance (1) it is the original
+// pinhole camera. Every ray gets a random time in the shutter interval [shutter_open, shutter_close].
 class Camera {
 public:
     // Constructors
@@ -19,30 +22,57 @@ public:
             point3D lookat,             // the point we look at
             Vec3D vup,                  // a vector representing the "up" direction of the camera
             double vfov,                // vertical field of view - in degrees
-            double aspect_ratio         // the proportional relationship between the width and the height of the display
-    ) {
+            double aspect_ratio,        // the proportional relationship between the width and the height of the display
+            double aperture = 0.0,      // diameter of the lens; 0 gives a pinhole camera (everything in focus)
+            double focus_distance = 1.0,// distance from lookfrom to the plane that is in perfect focus
+            double shutter_open = 0.0,  // time at which the shutter opens
+            double shutter_close = 0.0  // time at which the shutter closes
+    ) : lens_radius(aperture / 2), shutter_open(shutter_open), shutter_close(shutter_close) {
         double theta = degrees_to_radians(vfov);                    // vfov angle
         auto h = tan(theta/2);                                   // half-height of the viewport
+        tan_half_vfov = h;
         auto viewport_height = 2.0 * h;                             // viewport height
         auto viewport_width = aspect_ratio * viewport_height;       // viewport width
 
-        Vec3D camera_right, camera_up, camera_backward;                     // vectors that define the camera's plane
+        Vec3D camera_backward;                                              // vectors that define the camera's plane
         camera_backward = unit_vector(lookfrom - lookat);
         camera_right = unit_vector(cross_product(vup, camera_backward));
         camera_up = cross_product(camera_backward, camera_right);
 
         camera_origin = lookfrom;
-        viewport_horizontal_vector = viewport_width * camera_right;
-        viewport_vertical_vector = viewport_height * camera_up;
-        lower_left_corner = camera_origin - viewport_horizontal_vector/2 - viewport_vertical_vector/2 - camera_backward;
+        // The viewport is placed on the focus plane, so that points on it stay sharp for any lens sample
+        viewport_horizontal_vector = focus_distance * viewport_width * camera_right;
+        viewport_vertical_vector = focus_distance * viewport_height * camera_up;
+        lower_left_corner = camera_origin - viewport_horizontal_vector/2 - viewport_vertical_vector/2 - focus_distance * camera_backward;
     }
 
     // Supporting Functions
     // -----------------------------------------------------------------------
     Ray get_ray(double u, double v) const{
         // (u,v): pixel in the image plane.
-        // returns a ray sent from the camera;s origin towards (u,v).
-        return Ray(camera_origin, lower_left_corner + u*viewport_horizontal_vector + v*viewport_vertical_vector - camera_origin);
+        // returns a ray sent from a random point on the lens towards (u,v), at a random time
+        // while the shutter is open.
+        Vec3D lens_offset(0, 0, 0);
+        if (lens_radius > 0) {
+            Vec3D rd = lens_radius * random_in_unit_disk();
+            lens_offset = camera_right * rd.x() + camera_up * rd.y();
+        }
+
+        double time = shutter_open;
+        if (shutter_close > shutter_open)
+            time = shutter_open + (shutter_close - shutter_open) * sample_1D();
+
+        Ray r(camera_origin + lens_offset,
+              lower_left_corner + u*viewport_horizontal_vector + v*viewport_vertical_vector - camera_origin - lens_offset,
+              time);
+        r.set_cone(0.0, pixel_spread_angle);
+        return r;
+    }
+
+    void enable_ray_cones(int image_height) {
+        // Makes get_ray() start a ray cone as wide as one pixel (see Ray); off by default
+
+        pixel_spread_angle = atan(2.0 * tan_half_vfov / image_height);
     }
 
 public:
@@ -52,5 +82,11 @@ public:
     point3D lower_left_corner;                      // the lower left corner of the viewport
     Vec3D viewport_horizontal_vector;               // horizontal width of the viewport
     Vec3D viewport_vertical_vector;                 // vertical width of the viewport
+    Vec3D camera_right, camera_up;                  // lens axes, used to offset rays on the lens
+    double lens_radius = 0.0;                       // radius of the thin lens (aperture / 2)
+    double shutter_open = 0.0;                      // shutter interval
+    double shutter_close = 0.0;
+    double tan_half_vfov = 0.0;
+    double pixel_spread_angle = 0.0;                // angle of the ray cone of a pixel; 0 disables ray cones
 };
 #endif //CUDA_RAY_TRACER_CAMERA_H
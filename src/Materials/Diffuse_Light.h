@@ -11,15 +11,15 @@ class Diffuse_Light : public Material {
 public:
     // Constructors
     // -----------------------------------------------------------------------
-    Diffuse_Light(Color light_color) : light_color(light_color) {}
+    Diffuse_Light(Color light_color) : Material(DIFFUSE_LIGHT), light_color(light_color) {}
 
     Diffuse_Light(Color& lightColor, double& area, double& x_min, double& x_max,
-                  double& y_min, double& y_max, double& z_min, double& z_max) :
+                  double& y_min, double& y_max, double& z_min, double& z_max) : Material(DIFFUSE_LIGHT),
                   light_color(light_color), area(area), x_min(x_min), x_max(x_max),
                   y_min(y_min), y_max(y_max), z_min(z_min), z_max(z_max) {}
 
 
-    Diffuse_Light(Color light_color, double area, double x_min, double x_max, double y_min, double y_max, double z_min, double z_max) {
+    Diffuse_Light(Color light_color, double area, double x_min, double x_max, double y_min, double y_max, double z_min, double z_max) : Material(DIFFUSE_LIGHT) {
         // I think I can improve this.
 
         this->light_color = light_color;
@@ -32,14 +32,23 @@ public:
         this->z_max = z_max;
     }
 
-    // Overridden Functions
+    // Material Interface
     // -----------------------------------------------------------------------
-    bool evaluate(const Ray &incident_ray, const Intersection_Information &intersection_info, Color &shading_color,
-                  Ray &scattered_ray, MATERIAL_TYPE &type, double &pdf, std::shared_ptr<PDF>& surface_pdf_ptr) const override {
-        return false;
+    Material_Sample sample(const Ray &incident_ray, const Intersection_Information &intersection_info) const {
+        // A light does not scatter
+
+        return Material_Sample();
+    }
+
+    double pdf(const Ray &incident_ray, const Intersection_Information &intersection_info, const Ray &scattered_ray) const {
+        return 0;
+    }
+
+    Vec3D eval(const Ray &incident_ray, const Intersection_Information &intersection_information, const Ray &scattered_ray, const Color& attenuated_color) const {
+        return Vec3D(0,0,0);
     }
 
-    Color emitted(const point3D &p, const Intersection_Information& intersection_information) override {
+    Color emitted(const Intersection_Information& intersection_information) const {
         if (!intersection_information.front_face)
             return Color(0,0,0);
         return light_color;
@@ -13,35 +13,34 @@ class Diffuse_With_Texture : public Material {
 public:
     // Constructor
     // -----------------------------------------------------------------------
-    Diffuse_With_Texture(const std::shared_ptr<Texture>& surface_color) : surface_color(surface_color) {}
+    Diffuse_With_Texture(const std::shared_ptr<Texture>& surface_color) : Material(DIFFUSE_WITH_TEXTURE), surface_color(surface_color) {}
 
-    // Overridden Functions
+    // Material Interface
     // -----------------------------------------------------------------------
-    bool evaluate(const Ray &incident_ray, const Intersection_Information &intersection_info, Color &shading_color,
-                  Ray &scattered_ray, MATERIAL_TYPE &type, double &pdf, std::shared_ptr<PDF> &surface_pdf_ptr) const override {
+    Material_Sample sample(const Ray &incident_ray, const Intersection_Information &intersection_info) const {
+        Material_Sample s;
+
         // Generate a scattered ray with a direction from the corresponding PDF
-        surface_pdf_ptr = std::make_shared<Cosine_Weighted_PDF>(intersection_info.normal);          // A cosine-weighted distribution is physically correct
-        Vec3D scatter_direction = surface_pdf_ptr->generate_a_random_direction_based_on_PDF();
-        scattered_ray = Ray(intersection_info.p, unit_vector(scatter_direction), incident_ray.get_time());
+        s.surface_pdf_ptr = std::make_shared<Cosine_Weighted_PDF>(intersection_info.normal);        // A cosine-weighted distribution is physically correct
+        Vec3D scatter_direction = s.surface_pdf_ptr->generate_a_random_direction_based_on_PDF();
+        s.scattered_ray = Ray(intersection_info.p, unit_vector(scatter_direction), incident_ray.get_time());
 
         // Get the PDF value for the generated scattered ray direction (the sampling PDF)
-        pdf = surface_pdf_ptr->PDF_value(scattered_ray.get_ray_direction());
+        s.pdf = s.surface_pdf_ptr->PDF_value(s.scattered_ray.get_ray_direction());
 
         // Set the shading color to the surface texture color
-        shading_color = surface_color->value_at(intersection_info.u, intersection_info.v, intersection_info.p);
+        s.color = surface_color->filtered_value_at(intersection_info.u, intersection_info.v, intersection_info.p, intersection_info.texture_footprint());
 
-        return true;
+        s.scattered = true;
+        return s;
     }
 
-    double pdf(const Ray &incident_ray, const Intersection_Information &intersection_info, const Ray &scattered_ray) const override {
-        // DEPRECATED: Only needed if you will use the OLD formulation of diffuse (commented above).
-        // The new formulation used the PDF associated with the generated scattered ray direction.
-
+    double pdf(const Ray &incident_ray, const Intersection_Information &intersection_info, const Ray &scattered_ray) const {
         auto cos_theta = dot_product(intersection_info.normal, unit_vector(scattered_ray.get_ray_direction()));
         return cos_theta < 0 ? 0 : cos_theta/M_PI;
     }
 
-    Vec3D BRDF(const Ray &incident_ray, const Intersection_Information &intersection_information, const Ray &scattered_ray, Color& attenuated_color) const override {
+    Vec3D eval(const Ray &incident_ray, const Intersection_Information &intersection_information, const Ray &scattered_ray, const Color& attenuated_color) const {
         auto cos_theta = dot_product(intersection_information.normal, unit_vector(scattered_ray.get_ray_direction()));
         return cos_theta < 0 ? Vec3D(0,0,0) : attenuated_color * cos_theta/M_PI;
     }
@@ -14,28 +14,34 @@ class Disney_Diffuse : public Material {
 public:
     // Constructor
     // -----------------------------------------------------------------------
-    Disney_Diffuse(const Color& surface_color, double roughness) : surface_color(surface_color), roughness(roughness) {}
+    Disney_Diffuse(const Color& surface_color, double roughness) : Material(DISNEY_DIFFUSE), surface_color(surface_color), roughness(roughness) {}
 
-    // Overridden Functions
+    // Material Interface
     // -----------------------------------------------------------------------
-    bool evaluate(const Ray &incident_ray, const Intersection_Information &intersection_info, Color &shading_color,
-                  Ray &scattered_ray, MATERIAL_TYPE &type, double &pdf,
-                  std::shared_ptr<PDF> &surface_pdf_ptr) const override {
+    Material_Sample sample(const Ray &incident_ray, const Intersection_Information &intersection_info) const {
+        Material_Sample s;
+
         // Generate a scattered ray with a direction from the corresponding PDF
-        surface_pdf_ptr = std::make_shared<Cosine_Weighted_PDF>(intersection_info.normal);
-        Vec3D scatter_direction = surface_pdf_ptr->generate_a_random_direction_based_on_PDF();
-        scattered_ray = Ray(intersection_info.p, unit_vector(scatter_direction), incident_ray.get_time());
+        s.surface_pdf_ptr = std::make_shared<Cosine_Weighted_PDF>(intersection_info.normal);
+        Vec3D scatter_direction = s.surface_pdf_ptr->generate_a_random_direction_based_on_PDF();
+        s.scattered_ray = Ray(intersection_info.p, unit_vector(scatter_direction), incident_ray.get_time());
 
         // Get the PDF value for the generated scattered ray direction (the sampling PDF)
-        pdf = surface_pdf_ptr->PDF_value(scattered_ray.get_ray_direction());
+        s.pdf = s.surface_pdf_ptr->PDF_value(s.scattered_ray.get_ray_direction());
 
         // Set the shading color to the surface color
-        shading_color = surface_color;
+        s.color = surface_color;
+
+        s.scattered = true;
+        return s;
+    }
 
-        return true;
+    double pdf(const Ray &incident_ray, const Intersection_Information &intersection_info, const Ray &scattered_ray) const {
+        auto cos_theta = dot_product(intersection_info.normal, unit_vector(scattered_ray.get_ray_direction()));
+        return cos_theta < 0 ? 0 : cos_theta/M_PI;
     }
 
-    Vec3D BRDF(const Ray &incident_ray, const Intersection_Information &intersection_information, const Ray &scattered_ray, Color& attenuated_color) const override {
+    Vec3D eval(const Ray &incident_ray, const Intersection_Information &intersection_information, const Ray &scattered_ray, const Color& attenuated_color) const {
         // Evaluate Disney's diffuse reflectance
         double disney_diffuse = eval_Disney_diffuse(intersection_information.normal, unit_vector(scattered_ray.get_ray_direction()),
                                                     unit_vector(incident_ray.get_ray_direction()));
@@ -64,10 +70,10 @@ private:
         double FD90MinusOne = 2.0 * roughness * saturate(cos_theta_d) * saturate(cos_theta_d) - 0.5;            // Clamp to prevent numerical instability
 
         double cos_theta_L = dot_product(normal, scatter_direction);
-        double FDL = 1.0 + (FD90MinusOne * pow(1.0 - cos_theta_L, 5.0));
+        double FDL = 1.0 + (FD90MinusOne * pow5(1.0 - cos_theta_L));
 
         double cos_theta_V = dot_product(normal, viewer_direction);
-        double FDV = 1.0 + (FD90MinusOne * pow(1.0 - cos_theta_V, 5.0));
+        double FDV = 1.0 + (FD90MinusOne * pow5(1.0 - cos_theta_V));
 
         return FDL * FDV;
     }
@@ -11,30 +11,61 @@
 
 struct Intersection_Information;            // predef
 
-enum MATERIAL_TYPE {
-    SPECULAR = 111,
-    PHONG = 1600
+// Every material class, one value each. A material's type is the key into the material table
+// (Material_Table.h), which calls the concrete class directly instead of through a vtable.
+enum MATERIAL_TYPE : unsigned char {
+    DIFFUSE,
+    DIFFUSE_WITH_TEXTURE,
+    UNIFORM_HEMISPHERICAL_DIFFUSE,
+    DISNEY_DIFFUSE,
+    PHONG,
+    SPECULAR,
+    DIFFUSE_LIGHT,
+    NUMBER_OF_MATERIAL_TYPES
+};
+
+// What a material's sample() returns
+struct Material_Sample {
+    bool scattered = false;                     // false: the path ends here (the ray was absorbed, or hit a light)
+    bool is_specular = false;                   // the direction is fixed (a mirror): there is no PDF to mix light sampling
+                                                // with, and the radiance along scattered_ray is just weighted by color
+    Color color;                                // the surface color the BRDF is evaluated with
+    Ray scattered_ray;
+    double pdf = 0.0;                           // PDF of scattered_ray's direction
+    std::shared_ptr<PDF> surface_pdf_ptr;       // the distribution scattered_ray was drawn from (null if is_specular)
 };
 
 /// References:     - Fundamentals of Computer Graphics - Section 4.5.1: Light Sources
 ///                 - Fundamentals of Computer Graphics - Section 4.5.2: Shading in Software
+// The base of all materials. Each material class has the same non-virtual interface:
+//      Material_Sample sample(incident_ray, intersection_info):                  draws a scattered ray
+//      Vec3D eval(incident_ray, intersection_info, scattered_ray, surface_color):  the BRDF times the cosine
+//      double pdf(incident_ray, intersection_info, scattered_ray):                 the PDF sample() draws from
+//      Color emitted(intersection_info):                                           emitted radiance
+// Callers that only have a Material go through the material table, which switches on get_type().
 class Material {
 public:
     virtual ~Material()=default;
 
-    // Evaluates the shading model
-    virtual bool evaluate(const Ray& incident_ray, const Intersection_Information& intersection_info, Color& shading_color, Ray& scattered_ray, MATERIAL_TYPE& , double& pdf, std::shared_ptr<PDF>& surface_pdf_ptr) const = 0;
-
-    virtual double pdf(const Ray& incident_ray, const Intersection_Information& intersection_info, const Ray& scattered_ray) const {
-        return 0;
-    }
-    virtual Vec3D BRDF(const Ray& incident_ray, const Intersection_Information& intersection_information, const Ray& scattered_ray, Color& attenuated_color) const {
-        return Vec3D(1,1,1);
+    MATERIAL_TYPE get_type() const {
+        return type;
     }
 
     /// Reference: Fundamentals of Computer Graphics - Section 14.10
-    virtual Color emitted(const point3D& p, const Intersection_Information& intersection_information) {
+    Color emitted(const Intersection_Information& intersection_information) const {
+        // Only lights emit; Diffuse_Light hides this
+
         return Color(0,0,0);
     }
+
+protected:
+    // Constructor
+    // -----------------------------------------------------------------------
+    explicit Material(MATERIAL_TYPE type) : type(type) {}
+
+private:
+    // Data Members
+    // -----------------------------------------------------------------------
+    MATERIAL_TYPE type;
 };
 #endif //CUDA_RAY_TRACER_MATERIAL_H
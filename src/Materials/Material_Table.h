@@ -0,0 +1,61 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_MATERIAL_TABLE_H
+#define CUDA_RAY_TRACER_MATERIAL_TABLE_H
+
+#include "Diffuse.h"
+#include "Diffuse_With_Texture.h"
+#include "Uniform_Hemispherical_Diffuse.h"
+#include "Disney_Diffuse.h"
+#include "Phong.h"
+#include "Specular.h"
+#include "Diffuse_Light.h"
+
+// The material table: the material class of every MATERIAL_TYPE, and the sample/eval/pdf/emitted calls
+// for a material of any type. A call switches on Material::get_type() and calls the concrete class, so
+// nothing goes through a vtable, and a renderer that has sorted its hits by type (the wavefront renderer)
+// can use Material_Class<TYPE>::type to shade a whole batch with one class.
+// -----------------------------------------------------------------------
+template <MATERIAL_TYPE TYPE> struct Material_Class;
+template <> struct Material_Class<DIFFUSE> { typedef Diffuse type; };
+template <> struct Material_Class<DIFFUSE_WITH_TEXTURE> { typedef Diffuse_With_Texture type; };
+template <> struct Material_Class<UNIFORM_HEMISPHERICAL_DIFFUSE> { typedef Uniform_Hemispherical_Diffuse type; };
+template <> struct Material_Class<DISNEY_DIFFUSE> { typedef Disney_Diffuse type; };
+template <> struct Material_Class<PHONG> { typedef Phong type; };
+template <> struct Material_Class<SPECULAR> { typedef Specular type; };
+template <> struct Material_Class<DIFFUSE_LIGHT> { typedef Diffuse_Light type; };
+
+#define MATERIAL_TABLE_DISPATCH(material, call)                                                                  \
+    switch ((material).get_type()) {                                                                            \
+        case DIFFUSE: return static_cast<const Diffuse&>(material).call;                                        \
+        case DIFFUSE_WITH_TEXTURE: return static_cast<const Diffuse_With_Texture&>(material).call;              \
+        case UNIFORM_HEMISPHERICAL_DIFFUSE: return static_cast<const Uniform_Hemispherical_Diffuse&>(material).call; \
+        case DISNEY_DIFFUSE: return static_cast<const Disney_Diffuse&>(material).call;                          \
+        case PHONG: return static_cast<const Phong&>(material).call;                                            \
+        case SPECULAR: return static_cast<const Specular&>(material).call;                                      \
+        default: return static_cast<const Diffuse_Light&>(material).call;                                       \
+    }
+
+inline Material_Sample sample_material(const Material& material, const Ray& incident_ray, const Intersection_Information& intersection_info) {
+    MATERIAL_TABLE_DISPATCH(material, sample(incident_ray, intersection_info))
+}
+
+inline Vec3D eval_material(const Material& material, const Ray& incident_ray, const Intersection_Information& intersection_info,
+                           const Ray& scattered_ray, const Color& surface_color) {
+    MATERIAL_TABLE_DISPATCH(material, eval(incident_ray, intersection_info, scattered_ray, surface_color))
+}
+
+inline double material_pdf(const Material& material, const Ray& incident_ray, const Intersection_Information& intersection_info,
+                           const Ray& scattered_ray) {
+    MATERIAL_TABLE_DISPATCH(material, pdf(incident_ray, intersection_info, scattered_ray))
+}
+
+inline Color material_emission(const Material& material, const Intersection_Information& intersection_info) {
+    MATERIAL_TABLE_DISPATCH(material, emitted(intersection_info))
+}
+
+#undef MATERIAL_TABLE_DISPATCH
+
+#endif //CUDA_RAY_TRACER_MATERIAL_TABLE_H
@@ -12,48 +12,48 @@ class Phong : public Material {
 public:
     // Constructor
     // -------------------------------------------------------------------------------
-    Phong(const Color &surfaceColor, float specularIntensity, float shininess) : surface_color(surfaceColor),
+    Phong(const Color &surfaceColor, float specularIntensity, float shininess) : Material(PHONG),
+                                                                                 surface_color(surfaceColor),
                                                                                  specular_intensity(specularIntensity),
                                                                                  shininess(shininess) {}
-    // Overridden Functions
+    // Material Interface
     // -------------------------------------------------------------------------------
     /// References:         - Fundamentals of Computer Graphics - Section 5.2.2: Specular Reflection
     ///                     - Fundamentals of Computer Graphics - Section 5.2.3: Calculating Shading
     ///                     - Importance Sampling of the Phong Reflectance Model: https://www.cs.princeton.edu/courses/archive/fall16/cos526/papers/importance.pdf
-    bool evaluate(const Ray &incident_ray, const Intersection_Information &intersection_info, Color &shading_color,
-                  Ray &scattered_ray, MATERIAL_TYPE& material_type, double& pdf, std::shared_ptr<PDF>& surface_pdf_ptr) const override {
+    Material_Sample sample(const Ray &incident_ray, const Intersection_Information &intersection_info) const {
+            Material_Sample s;
 
-
-            double u = random_double();                 // generate a random variable u ∈ [0,1]
+            double u = sample_1D();                     // generate a random variable u ∈ [0,1]
 
             double k_d = 0.5;           // diffuse component
             double k_s = 0.5;           // specular component
 
             if (u < k_d) {
                 // Take a diffuse sample and compute its contribution
-                surface_pdf_ptr = std::make_shared<Cosine_Weighted_PDF>(intersection_info.normal);
-                Vec3D scatter_direction = surface_pdf_ptr->generate_a_random_direction_based_on_PDF();
-                scattered_ray = Ray(intersection_info.p, unit_vector(scatter_direction), incident_ray.get_time());
-                pdf = surface_pdf_ptr->PDF_value(scattered_ray.get_ray_direction());
-                shading_color = surface_color;
+                s.surface_pdf_ptr = std::make_shared<Cosine_Weighted_PDF>(intersection_info.normal);
+                Vec3D scatter_direction = s.surface_pdf_ptr->generate_a_random_direction_based_on_PDF();
+                s.scattered_ray = Ray(intersection_info.p, unit_vector(scatter_direction), incident_ray.get_time());
+                s.pdf = s.surface_pdf_ptr->PDF_value(s.scattered_ray.get_ray_direction());
+                s.color = surface_color;
             } else if (k_d <= u && u < k_d + k_s) {
                 // Take a specular sample and compute its contribution
-                surface_pdf_ptr = std::make_shared<Specular_PDF>(incident_ray.get_ray_direction(), intersection_info.normal, shininess);
-                Vec3D scatter_direction = surface_pdf_ptr->generate_a_random_direction_based_on_PDF();
-                scattered_ray = Ray(intersection_info.p, unit_vector(scatter_direction), incident_ray.get_time());
-                pdf = surface_pdf_ptr->PDF_value(scattered_ray.get_ray_direction());
-                shading_color = surface_color;
+                s.surface_pdf_ptr = std::make_shared<Specular_PDF>(incident_ray.get_ray_direction(), intersection_info.normal, shininess);
+                Vec3D scatter_direction = s.surface_pdf_ptr->generate_a_random_direction_based_on_PDF();
+                s.scattered_ray = Ray(intersection_info.p, unit_vector(scatter_direction), incident_ray.get_time());
+                s.pdf = s.surface_pdf_ptr->PDF_value(s.scattered_ray.get_ray_direction());
+                s.color = surface_color;
             } else {
                 // Contribution is 0
-                return false;
+                return s;
             }
 
-            return true;
+            s.scattered = true;
+            return s;
 
             /* OLD - but works. Use it if you don't wish to do importance sampling for Phong materials. */
             /*
-            surface_pdf_ptr = nullptr;              // no BRDF
-            material_type = PHONG;                  // Material Type
+            s.is_specular = true;                   // no BRDF
 
             // Diffuse reflection
             Vec3D reflection_direction = diffuse_reflection_direction(intersection_info.normal);
@@ -68,13 +68,22 @@ public:
             // Combine diffuse and specular reflections
             shading_color = surface_color * (diffuse_component + specular_component * specular_intensity) / M_PI;
 
-            return true;
+            s.scattered = true;
+            return s;
             */
         }
 
+    double pdf(const Ray &incident_ray, const Intersection_Information &intersection_info, const Ray &scattered_ray) const {
+        // sample() picks the diffuse and the specular lobe with probability 1/2 each
+
+        double diffuse_pdf = Cosine_Weighted_PDF(intersection_info.normal).PDF_value(scattered_ray.get_ray_direction());
+        double specular_pdf = Specular_PDF(incident_ray.get_ray_direction(), intersection_info.normal, shininess).PDF_value(scattered_ray.get_ray_direction());
+        return 0.5 * diffuse_pdf + 0.5 * specular_pdf;
+    }
+
     /// Reference:  - Crash Course in BRDF Implementation: https://boksajak.github.io/files/CrashCourseBRDF.pdf
-    Vec3D BRDF(const Ray &incident_ray, const Intersection_Information &intersection_information, const Ray &scattered_ray,
-         Color &attenuated_color) const override {
+    Vec3D eval(const Ray &incident_ray, const Intersection_Information &intersection_information, const Ray &scattered_ray,
+         const Color &attenuated_color) const {
         // Computes the BRDF of a Phong material, which is given be the equation:
         //                BrdfPhong = specular_reflectance * pow(dot(R, V), shininess) * dot(N, L)
 
@@ -90,7 +99,7 @@ public:
         //   std::cout << attenuated_color * (specular_intensity * std::pow(cos_alpha, shininess)) << std::endl;
 
         // Phong BRDF
-        return attenuated_color * (specular_intensity * std::pow(cos_alpha, shininess));
+        return attenuated_color * (specular_intensity * Default_Math::pow(cos_alpha, shininess));
 
     }
 
@@ -12,7 +12,7 @@ class Specular : public Material {
 public:
     // Constructor
     // -----------------------------------------------------------------------
-    Specular(const Color& surface_color, double glossy_reflection_fraction, double index_of_refraction) : surface_color(
+    Specular(const Color& surface_color, double glossy_reflection_fraction, double index_of_refraction) : Material(SPECULAR), surface_color(
             surface_color), glossy_reflection_fraction(glossy_reflection_fraction), index_of_refraction(
             index_of_refraction) {
         if (glossy_reflection_fraction > 0) {
@@ -31,15 +31,17 @@ public:
     // -----------------------------------------------------------------------
     ~Specular() override = default;
 
+    // Material Interface
+    // -----------------------------------------------------------------------
     /// References:             - Fundamentals of Computer Graphics: Section 4.5.4: Mirror Reflection
     ///                         - Fundamentals of Computer Graphics: Section 14.2: Smooth Metals
     ///                         - Fundamentals of Computer Graphics: Section 14.3.1: Reflectivity of a Dielectric
     ///                         - Fundamentals of Computer Graphics: Section 14.3.2: Refraction
-    bool evaluate(const Ray &incident_ray, const Intersection_Information &intersection_info, Color &shading_color,
-                  Ray &scattered_ray, MATERIAL_TYPE& material_type, double& pdf, std::shared_ptr<PDF>& surface_pdf_ptr) const override {
+    Material_Sample sample(const Ray &incident_ray, const Intersection_Information &intersection_info) const {
+        Material_Sample s;
+
         if (reflection) {
-            surface_pdf_ptr = nullptr;
-            material_type = SPECULAR;
+            s.is_specular = true;
 
             // Calculate the direction of the reflected vector
             Vec3D R = specular_reflection_direction(unit_vector(incident_ray.get_ray_direction()),
@@ -49,17 +51,28 @@ public:
             R += glossy_reflection_fraction * random_unit_vector();
 
             // Initialize the reflect ray
-            scattered_ray = Ray(intersection_info.p, R);
+            s.scattered_ray = Ray(intersection_info.p, R);
 
             // A specular material (mirror) reflects the same color
-            shading_color = surface_color;
+            s.color = surface_color;
 
             // Reflection inside the object surface do not illuminate the scene
-            bool illumination = dot_product(scattered_ray.get_ray_direction(), intersection_info.normal) > 0;
-            return illumination;
+            s.scattered = dot_product(s.scattered_ray.get_ray_direction(), intersection_info.normal) > 0;
         }
 
-        return false;
+        return s;
+    }
+
+    double pdf(const Ray &incident_ray, const Intersection_Information &intersection_info, const Ray &scattered_ray) const {
+        // A mirror reflects in one direction only
+
+        return 0;
+    }
+
+    Vec3D eval(const Ray &incident_ray, const Intersection_Information &intersection_information, const Ray &scattered_ray, const Color& attenuated_color) const {
+        // Only used when the caller ignores is_specular; the radiance is then weighted by the color alone
+
+        return attenuated_color;
     }
 
 public:
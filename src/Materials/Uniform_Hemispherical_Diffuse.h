@@ -13,26 +13,27 @@ class Uniform_Hemispherical_Diffuse : public Material {
 public:
     // Constructor
     // -----------------------------------------------------------------------
-    Uniform_Hemispherical_Diffuse(const Color& surface_color) : surface_color(surface_color) {}
+    Uniform_Hemispherical_Diffuse(const Color& surface_color) : Material(UNIFORM_HEMISPHERICAL_DIFFUSE), surface_color(surface_color) {}
 
-    // Overridden Functions
+    // Material Interface
     // -----------------------------------------------------------------------
     /// Reference: 14.7.1: BRDF
-    bool evaluate(const Ray &incident_ray, const Intersection_Information &intersection_info, Color &shading_color,
-                  Ray &scattered_ray, MATERIAL_TYPE& material_type, double& pdf, std::shared_ptr<PDF>& surface_pdf_ptr) const override {
+    Material_Sample sample(const Ray &incident_ray, const Intersection_Information &intersection_info) const {
+        Material_Sample s;
 
         // Generate a scattered ray with a direction from the corresponding PDF
-        surface_pdf_ptr = std::make_shared<Uniform_Hemispherical_PDF>(intersection_info.normal);
-        Vec3D scatter_direction = surface_pdf_ptr->generate_a_random_direction_based_on_PDF(intersection_info.normal);
-        scattered_ray = Ray(intersection_info.p, scatter_direction);
+        s.surface_pdf_ptr = std::make_shared<Uniform_Hemispherical_PDF>(intersection_info.normal);
+        Vec3D scatter_direction = s.surface_pdf_ptr->generate_a_random_direction_based_on_PDF(intersection_info.normal);
+        s.scattered_ray = Ray(intersection_info.p, scatter_direction);
 
         // Get the PDF value for the generated scattered ray direction
-        pdf = uniform_pdf();            // A uniform hemispherical diffuse always has a pdf of 1/2π
+        s.pdf = uniform_pdf();          // A uniform hemispherical diffuse always has a pdf of 1/2π
 
         // Set the shading color to the surface color
-        shading_color = surface_color;
+        s.color = surface_color;
 
-        return true;
+        s.scattered = true;
+        return s;
         /*
         // OLD - BUT WORKING WITH ONLY radiance_background() or radiance() (i.e., no importance sampling)
         Vec3D reflection_direction = random_on_hemisphere(intersection_info.normal);
@@ -43,8 +44,12 @@ public:
         */
     }
 
-    Vec3D BRDF(const Ray &incident_ray, const Intersection_Information &intersection_information,
-               const Ray &scattered_ray, Color& attenuated_color) const override {
+    double pdf(const Ray &incident_ray, const Intersection_Information &intersection_info, const Ray &scattered_ray) const {
+        return dot_product(intersection_info.normal, scattered_ray.get_ray_direction()) < 0 ? 0 : uniform_pdf();
+    }
+
+    Vec3D eval(const Ray &incident_ray, const Intersection_Information &intersection_information,
+               const Ray &scattered_ray, const Color& attenuated_color) const {
         return attenuated_color * (1 / (2*M_PI));
     }
 
@@ -0,0 +1,226 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_FAST_MATH_H
+#define CUDA_RAY_TRACER_FAST_MATH_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+/// Reference: Jean-Michel Muller - Elementary Functions: Algorithms and Implementation (3rd ed.), Chapters 3 and 11
+/// Reference: W. J. Cody and W. Waite - Software Manual for the Elementary Functions (argument reduction)
+// The transcendental functions of the sampling and BRDF code (sin, cos, sincos, acos, exp, log, pow) in three
+// accuracy tiers, as tag types with static functions:
+//
+//      Libm_Math       the C library (std::sin, ...); correctly rounded or within 1 ulp
+//      Accurate_Math   polynomials; error below 1e-13 (see max_error()), about 500 times an ulp at 1
+//      Fast_Math       shorter polynomials; error below 1e-6, plenty for sampling directions
+//
+// Errors are absolute for sin, cos and acos and relative for exp and log. pow(x,y) = exp(y log(x)) is within
+// max_error() * (1 + |y log(x)|) relative; negative x and the other special cases go to std::pow. sin and cos
+// reduce their argument with a two-constant Cody-Waite step, which holds for |x| < 1e5; larger arguments
+// go to the C library too. The polynomials are truncated Taylor series, so the bounds are those of the
+// first term left out (plus a few ulps of rounding), and Functions_Tests.h checks them against libm.
+//
+// The sampling and BRDF code calls Default_Math, chosen at compile time like the intersection kernels: define
+// MATH_ACCURACY (the CMake cache variable of the same name does that), e.g. -DMATH_ACCURACY=Fast_Math.
+// -----------------------------------------------------------------------
+
+// Supporting Functions
+// -----------------------------------------------------------------------
+template <int N>
+inline double polynomial(const double* c, double x) {
+    // c[0] + c[1] x + ... + c[N-1] x^(N-1), by Horner's rule
+
+    double p = c[N - 1];
+    for (int k = N - 2; k >= 0; --k)
+        p = p * x + c[k];
+    return p;
+}
+
+// Taylor coefficients; the tiers below use the first few of each series
+static const double SIN_COEFFICIENTS[] = {1.0, -1.0 / 6, 1.0 / 120, -1.0 / 5040, 1.0 / 362880, -1.0 / 39916800,
+                                          1.0 / 6227020800.0, -1.0 / 1307674368000.0};      // sin(r)/r in r^2
+static const double COS_COEFFICIENTS[] = {1.0, -1.0 / 2, 1.0 / 24, -1.0 / 720, 1.0 / 40320, -1.0 / 3628800,
+                                          1.0 / 479001600, -1.0 / 87178291200.0, 1.0 / 20922789888000.0};
+static const double EXP_COEFFICIENTS[] = {1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720, 1.0 / 5040,
+                                          1.0 / 40320, 1.0 / 362880, 1.0 / 3628800, 1.0 / 39916800, 1.0 / 479001600};
+static const double LOG_COEFFICIENTS[] = {1.0, 1.0 / 3, 1.0 / 5, 1.0 / 7, 1.0 / 9, 1.0 / 11, 1.0 / 13, 1.0 / 15};
+                                                                                            // atanh(s)/s in s^2
+static const double ASIN_COEFFICIENTS[] = {1, 0.16666666666666666, 0.074999999999999997, 0.044642857142857144,
+                                           0.030381944444444444, 0.022372159090909092, 0.017352764423076924,
+                                           0.013964843750000001, 0.011551800896139705, 0.0097616095291940784,
+                                           0.0083903358096168151, 0.0073125258735988454, 0.0064472103118896487,
+                                           0.0057400376708419236, 0.0051533096823199046, 0.0046601434869150962,
+                                           0.0042409070936793632, 0.0038809645588376691, 0.0035692053938259347};
+                                                                // asin(t)/t in t^2: (2n)! / (4^n (n!)^2 (2n+1))
+
+inline double pow5(double x) {
+    // x^5 in three multiplications instead of a call to pow(x, 5.0)
+
+    double x2 = x * x;
+    return x2 * x2 * x;
+}
+
+inline double sin_from_cos(double cos_theta) {
+    // sin(theta) for theta in [0,pi], given cos(theta): no trigonometric call needed
+
+    return std::sqrt(std::fmax(0.0, 1.0 - cos_theta * cos_theta));
+}
+
+// Polynomial Approximations
+// -----------------------------------------------------------------------
+template <int Sin_Terms, int Cos_Terms, int Exp_Terms, int Log_Terms, int Asin_Terms>
+struct Polynomial_Math {
+    // Sin_Terms terms of the Taylor series of sin(r)/r and Cos_Terms of cos(r) on |r| <= pi/4, Exp_Terms of
+    // exp(r) on |r| <= ln(2)/2, Log_Terms of atanh(s)/s on |s| <= 0.172 and Asin_Terms of asin(t)/t on
+    // |t| <= 1/2.
+
+    static void sincos(double x, double& s, double& c) {
+        if (!(std::fabs(x) < 1e5)) {
+            s = std::sin(x);
+            c = std::cos(x);
+            return;
+        }
+
+        // x = k pi/2 + r, |r| <= pi/4. pi/2 is split in two so that k * PIO2_HI is exact.
+        const double TWO_OVER_PI = 0.63661977236758134308;
+        const double PIO2_HI = 1.57079632673412561417;
+        const double PIO2_LO = 6.07710050650619224932e-11;
+        double k = std::nearbyint(x * TWO_OVER_PI);
+        double r = (x - k * PIO2_HI) - k * PIO2_LO;
+        double r2 = r * r;
+
+        double sin_r = r * polynomial<Sin_Terms>(SIN_COEFFICIENTS, r2);
+        double cos_r = polynomial<Cos_Terms>(COS_COEFFICIENTS, r2);
+
+        switch (static_cast<int64_t>(k) & 3) {
+            case 0: s = sin_r; c = cos_r; break;
+            case 1: s = cos_r; c = -sin_r; break;
+            case 2: s = -sin_r; c = -cos_r; break;
+            default: s = -cos_r; c = sin_r; break;
+        }
+    }
+
+    static double sin(double x) {
+        double s, c;
+        sincos(x, s, c);
+        return s;
+    }
+
+    static double cos(double x) {
+        double s, c;
+        sincos(x, s, c);
+        return c;
+    }
+
+    static double acos(double x) {
+        // acos(x) = pi/2 - asin(x) for |x| <= 1/2, and 2 asin(sqrt((1-|x|)/2)) (mirrored for x < 0) beyond
+
+        const double PI = 3.14159265358979323846;
+        if (!(std::fabs(x) <= 1.0))
+            return std::acos(x);            // NaN
+        if (std::fabs(x) <= 0.5)
+            return PI / 2 - asin_small(x);
+
+        double a = 2.0 * asin_small(std::sqrt((1.0 - std::fabs(x)) * 0.5));
+        return x > 0 ? a : PI - a;
+    }
+
+    static double exp(double x) {
+        if (!(x > -708.0 && x < 709.0))
+            return std::exp(x);             // overflow, underflow to subnormals, NaN
+
+        // x = k ln(2) + r, |r| <= ln(2)/2, and exp(x) = 2^k exp(r); ln(2) is split as pi/2 above
+        const double LOG2_E = 1.44269504088896338700;
+        const double LN2_HI = 6.93147180369123816490e-01;
+        const double LN2_LO = 1.90821492927058770002e-10;
+        double k = std::nearbyint(x * LOG2_E);
+        double r = (x - k * LN2_HI) - k * LN2_LO;
+
+        uint64_t bits = static_cast<uint64_t>(static_cast<int64_t>(k) + 1023) << 52;
+        double two_to_k;
+        std::memcpy(&two_to_k, &bits, sizeof(two_to_k));
+        return polynomial<Exp_Terms>(EXP_COEFFICIENTS, r) * two_to_k;
+    }
+
+    static double log(double x) {
+        uint64_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        int exponent = static_cast<int>(bits >> 52) - 1023;
+        if (exponent <= -1023 || exponent >= 1024)
+            return std::log(x);             // 0, subnormals, negative numbers, infinity, NaN
+
+        // x = m 2^e with m in [sqrt(1/2), sqrt(2)), and ln(m) = 2 atanh(s) with s = (m-1)/(m+1)
+        bits = (bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+        double m;
+        std::memcpy(&m, &bits, sizeof(m));
+        if (m > 1.41421356237309504880) {
+            m *= 0.5;
+            exponent++;
+        }
+
+        const double LN2_HI = 6.93147180369123816490e-01;
+        const double LN2_LO = 1.90821492927058770002e-10;
+        double s = (m - 1.0) / (m + 1.0);
+        double log_m = 2.0 * s * polynomial<Log_Terms>(LOG_COEFFICIENTS, s * s);
+        return exponent * LN2_HI + (log_m + exponent * LN2_LO);
+    }
+
+    static double pow(double x, double y) {
+        if (!(x > 0.0) || !std::isfinite(x) || !std::isfinite(y))
+            return std::pow(x, y);
+        return exp(y * log(x));
+    }
+
+private:
+    static_assert(Sin_Terms <= 8 && Cos_Terms <= 9 && Exp_Terms <= 13 && Log_Terms <= 8 && Asin_Terms <= 19,
+                  "MORE TERMS THAN THE COEFFICIENT TABLES HOLD");
+
+    static double asin_small(double t) {
+        // asin(t) for |t| <= 1/2
+        return t * polynomial<Asin_Terms>(ASIN_COEFFICIENTS, t * t);
+    }
+};
+
+// Accuracy Tiers
+// -----------------------------------------------------------------------
+struct Libm_Math {
+    static const char* name() { return "libm"; }
+    static double max_error() { return 0.0; }           // the reference the others are tested against
+
+    static void sincos(double x, double& s, double& c) {
+        s = std::sin(x);
+        c = std::cos(x);
+    }
+    static double sin(double x) { return std::sin(x); }
+    static double cos(double x) { return std::cos(x); }
+    static double acos(double x) { return std::acos(x); }
+    static double exp(double x) { return std::exp(x); }
+    static double log(double x) { return std::log(x); }
+    static double pow(double x, double y) { return std::pow(x, y); }
+};
+
+// Truncation errors: sin r^15/15! = 2e-14, cos r^16/16! = 1e-15, exp r^13/13! = 2e-16, log s^16/17 = 3e-14
+// (relative), acos 2 * 8e-15
+struct Accurate_Math : Polynomial_Math<7, 8, 13, 8, 19> {
+    static const char* name() { return "accurate"; }
+    static double max_error() { return 1e-13; }
+};
+
+// Truncation errors: sin r^9/9! = 3e-7, cos r^10/10! = 3e-8, exp r^7/7! = 1e-7, log s^8/9 = 8e-8 (relative),
+// acos 2 * 1.1e-7
+struct Fast_Math : Polynomial_Math<4, 5, 7, 4, 8> {
+    static const char* name() { return "fast"; }
+    static double max_error() { return 1e-6; }
+};
+
+#ifndef MATH_ACCURACY
+#define MATH_ACCURACY Libm_Math
+#endif
+
+typedef MATH_ACCURACY Default_Math;
+
+#endif //CUDA_RAY_TRACER_FAST_MATH_H
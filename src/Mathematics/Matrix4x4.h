@@ -0,0 +1,146 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_MATRIX4X4_H
+#define CUDA_RAY_TRACER_MATRIX4X4_H
+
+#include "../Utilities.h"
+
+/// Reference: Fundamentals of Computer Graphics - Section 7.2: Affine Transformations
+// A 4x4 matrix to represent affine transformations. Only affine matrices are supported, so
+// the bottom row is always (0,0,0,1) and the inverse can be computed from the 3x3 part.
+class Matrix4x4 {
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    Matrix4x4() : M{{1,0,0,0}, {0,1,0,0}, {0,0,1,0}, {0,0,0,1}} {}         // identity
+
+    Matrix4x4(double m00, double m01, double m02, double m03,
+              double m10, double m11, double m12, double m13,
+              double m20, double m21, double m22, double m23)
+              : M{{m00, m01, m02, m03}, {m10, m11, m12, m13}, {m20, m21, m22, m23}, {0, 0, 0, 1}} {}
+
+    // Factory Functions
+    // -----------------------------------------------------------------------
+    static Matrix4x4 translation(const Vec3D& displacement) {
+        return {1, 0, 0, displacement.x(),
+                0, 1, 0, displacement.y(),
+                0, 0, 1, displacement.z()};
+    }
+
+    static Matrix4x4 scaling(const Vec3D& scale) {
+        return {scale.x(), 0, 0, 0,
+                0, scale.y(), 0, 0,
+                0, 0, scale.z(), 0};
+    }
+
+    static Matrix4x4 rotation_X(double angle_in_degrees) {
+        double c = cos(degrees_to_radians(angle_in_degrees));
+        double s = sin(degrees_to_radians(angle_in_degrees));
+        return {1, 0,  0, 0,
+                0, c, -s, 0,
+                0, s,  c, 0};
+    }
+
+    static Matrix4x4 rotation_Y(double angle_in_degrees) {
+        // Same convention as Rotate_Y: x' = cos*x + sin*z, z' = -sin*x + cos*z
+        double c = cos(degrees_to_radians(angle_in_degrees));
+        double s = sin(degrees_to_radians(angle_in_degrees));
+        return { c, 0, s, 0,
+                 0, 1, 0, 0,
+                -s, 0, c, 0};
+    }
+
+    static Matrix4x4 rotation_Z(double angle_in_degrees) {
+        double c = cos(degrees_to_radians(angle_in_degrees));
+        double s = sin(degrees_to_radians(angle_in_degrees));
+        return {c, -s, 0, 0,
+                s,  c, 0, 0,
+                0,  0, 1, 0};
+    }
+
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    point3D transform_point(const point3D& p) const {
+        return {M[0][0] * p.x() + M[0][1] * p.y() + M[0][2] * p.z() + M[0][3],
+                M[1][0] * p.x() + M[1][1] * p.y() + M[1][2] * p.z() + M[1][3],
+                M[2][0] * p.x() + M[2][1] * p.y() + M[2][2] * p.z() + M[2][3]};
+    }
+
+    Vec3D transform_vector(const Vec3D& v) const {
+        // Vectors (directions) are not affected by the translation column
+
+        return {M[0][0] * v.x() + M[0][1] * v.y() + M[0][2] * v.z(),
+                M[1][0] * v.x() + M[1][1] * v.y() + M[1][2] * v.z(),
+                M[2][0] * v.x() + M[2][1] * v.y() + M[2][2] * v.z()};
+    }
+
+    Matrix4x4 transpose_3x3() const {
+        // Transposes the linear (3x3) part and drops the translation. This is what
+        // normals need: n' = (M^-1)^T n.
+
+        return {M[0][0], M[1][0], M[2][0], 0,
+                M[0][1], M[1][1], M[2][1], 0,
+                M[0][2], M[1][2], M[2][2], 0};
+    }
+
+    double determinant_3x3() const {
+        // Determinant of the linear (3x3) part: how much the transformation scales volumes
+
+        return M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]) +
+               M[0][1] * (M[1][2] * M[2][0] - M[1][0] * M[2][2]) +
+               M[0][2] * (M[1][0] * M[2][1] - M[1][1] * M[2][0]);
+    }
+
+    /// Reference: Fundamentals of Computer Graphics - Section 6.1.4: Determinants / 6.3: Inverse
+    Matrix4x4 inverse() const {
+        // Inverts the affine matrix [A | t] as [A^-1 | -A^-1 t], where A^-1 is computed from
+        // the cofactors of A.
+
+        double c00 = M[1][1] * M[2][2] - M[1][2] * M[2][1];
+        double c01 = M[1][2] * M[2][0] - M[1][0] * M[2][2];
+        double c02 = M[1][0] * M[2][1] - M[1][1] * M[2][0];
+
+        double det = M[0][0] * c00 + M[0][1] * c01 + M[0][2] * c02;
+        if (fabs(det) < 1e-12) {
+            std::cerr << "MATRIX4X4: SINGULAR TRANSFORMATION CANNOT BE INVERTED!\n";
+            exit(0);
+        }
+        double inv_det = 1.0 / det;
+
+        Matrix4x4 inv(
+                c00 * inv_det, (M[0][2] * M[2][1] - M[0][1] * M[2][2]) * inv_det, (M[0][1] * M[1][2] - M[0][2] * M[1][1]) * inv_det, 0,
+                c01 * inv_det, (M[0][0] * M[2][2] - M[0][2] * M[2][0]) * inv_det, (M[0][2] * M[1][0] - M[0][0] * M[1][2]) * inv_det, 0,
+                c02 * inv_det, (M[0][1] * M[2][0] - M[0][0] * M[2][1]) * inv_det, (M[0][0] * M[1][1] - M[0][1] * M[1][0]) * inv_det, 0
+                );
+
+        Vec3D inv_t = inv.transform_vector(Vec3D(M[0][3], M[1][3], M[2][3]));
+        inv.M[0][3] = -inv_t.x();
+        inv.M[1][3] = -inv_t.y();
+        inv.M[2][3] = -inv_t.z();
+
+        return inv;
+    }
+
+public:
+    // Data Members
+    // -----------------------------------------------------------------------
+    double M[4][4];             // row-major entries
+};
+
+// Matrix operations
+// ------------------------------------------------------------------------
+inline Matrix4x4 operator*(const Matrix4x4& A, const Matrix4x4& B) {
+    // Composes two transformations: (A * B) applies B first, then A.
+
+    Matrix4x4 C;
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            C.M[i][j] = A.M[i][0] * B.M[0][j] + A.M[i][1] * B.M[1][j] + A.M[i][2] * B.M[2][j] + A.M[i][3] * B.M[3][j];
+        }
+    }
+    return C;
+}
+
+#endif //CUDA_RAY_TRACER_MATRIX4X4_H
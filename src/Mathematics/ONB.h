@@ -0,0 +1,66 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_ONB_H
+#define CUDA_RAY_TRACER_ONB_H
+
+#include <cmath>
+#include "Vec3D.h"
+
+/// References:         - Fundamentals of Computer Graphics - Section 2.4.5: Orthonormal Bases and Coordinate Frames
+///                     - Building an Orthonormal Basis, Revisited (Duff et al. 2017): https://jcgt.org/published/0006/01/01/
+// An orthonormal basis (u,v,w) built around a single vector w. It is a plain value type, so the PDFs
+// can keep one by value instead of allocating a std::vector per bounce. The construction is the
+// branchless one of Duff et al., which is robust for every w (including w close to -z).
+class ONB {
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    ONB() : axis{Vec3D(1, 0, 0), Vec3D(0, 1, 0), Vec3D(0, 0, 1)} {}
+
+    explicit ONB(const Vec3D& direction) {
+        Vec3D n = unit_vector(direction);
+
+        double sign = std::copysign(1.0, n.z());
+        double a = -1.0 / (sign + n.z());
+        double b = n.x() * n.y() * a;
+
+        axis[0] = Vec3D(1.0 + sign * n.x() * n.x() * a, sign * b, -sign * n.x());
+        axis[1] = Vec3D(b, sign + n.y() * n.y() * a, -n.y());
+        axis[2] = n;
+    }
+
+    // Getters
+    // -----------------------------------------------------------------------
+    const Vec3D& u() const { return axis[0]; }
+    const Vec3D& v() const { return axis[1]; }
+    const Vec3D& w() const { return axis[2]; }
+
+    const Vec3D& operator[](int i) const { return axis[i]; }
+
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    Vec3D to_world(double a, double b, double c) const {
+        // Local coordinates (a,b,c) in the basis -> world space
+
+        return a * axis[0] + b * axis[1] + c * axis[2];
+    }
+
+    Vec3D to_world(const Vec3D& local) const {
+        return to_world(local.x(), local.y(), local.z());
+    }
+
+    Vec3D to_local(const Vec3D& world) const {
+        // World space -> coordinates in the basis
+
+        return {dot_product(world, axis[0]), dot_product(world, axis[1]), dot_product(world, axis[2])};
+    }
+
+private:
+    // Data Members
+    // -----------------------------------------------------------------------
+    Vec3D axis[3];              // u, v, w
+};
+
+#endif //CUDA_RAY_TRACER_ONB_H
@@ -11,25 +11,23 @@ class Cosine_Weighted_PDF : public PDF {
 public:
     // Constructor
     // -----------------------------------------------------------------------
-    Cosine_Weighted_PDF(const Vec3D& w) {
-        uvw = build_ONB(w);
-    }
+    Cosine_Weighted_PDF(const Vec3D& w) : uvw(w) {}
 
     // Overridden Functions
     // -----------------------------------------------------------------------
     double PDF_value(const Vec3D& direction) const override {
-        auto cosine_theta = dot_product(uvw[2], unit_vector(direction));
+        auto cosine_theta = dot_product(uvw.w(), unit_vector(direction));
         return fmax(0, cosine_theta/M_PI);
     }
 
     Vec3D generate_a_random_direction_based_on_PDF() const override {
-        return global_to_ONB_local(uvw, cosine_weighted_direction());
+        return uvw.to_world(cosine_weighted_direction());
     }
 
 private:
     // Data members
     // -----------------------------------------------------------------------
-    std::vector<Vec3D> uvw;             // uvw forms the orthonormal basis
+    ONB uvw;                            // uvw forms the orthonormal basis
 };
 
 
@@ -32,7 +32,7 @@ public:
     }
 
     Vec3D generate_a_random_direction_based_on_PDF() const override {
-        if (random_double() < 0.5) {
+        if (sample_1D() < 0.5) {
             //    if (std::isnan(p[0]->generate_a_random_direction_based_on_PDF().x())) {
             //    std::cout << p[0]->generate_a_random_direction_based_on_PDF();
             //    }
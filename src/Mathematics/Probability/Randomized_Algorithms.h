@@ -6,6 +6,7 @@
 #define CUDA_RAY_TRACER_RANDOMIZED_ALGORITHMS_H
 
 #include "../../Utilities.h"
+#include "../../Samplers/Sampler.h"
 #include <random>
 static int num_calls_rand_double = 0;
 // Constants
@@ -27,6 +28,28 @@ inline double random_double(double lower_bound, double upper_bound) {
     return lower_bound + (upper_bound-lower_bound)*random_double();
 }
 
+inline double sample_1D() {
+    // The next sample dimension of the active sampler (see Samplers/Sampler.h), or a random double
+    // between [0.0,1.0) if the thread has none. Use this instead of random_double() for the values
+    // that shape a path (pixel jitter, lens, time, light and BSDF samples), so that samplers can
+    // stratify them.
+
+    Sampler* sampler = active_sampler();
+    return sampler ? sampler->get_1D() : random_double();
+}
+
+inline Vec2D sample_2D() {
+    // Two sample dimensions that are used together, e.g. to pick a direction or a point on a light
+
+    Sampler* sampler = active_sampler();
+    if (sampler)
+        return sampler->get_2D();
+
+    double u1 = random_double();
+    double u2 = random_double();
+    return {u1, u2};
+}
+
 static Vec3D random_vector_in_range(double lower_bound, double upper_bound) {
     // Returns a random vector with each of its components in the range: [lower_bound,upper_bound).
 
@@ -63,6 +86,31 @@ inline Vec3D random_unit_vector() {
     } while (true);
 }
 
+/// Reference: A Low Distortion Map Between Disk and Square (Shirley & Chiu 1997)
+inline Vec3D random_in_unit_disk() {
+    // Returns a random point inside the unit disk on the XY-plane (used to sample the camera lens).
+    // The concentric mapping keeps the stratification of the sampler, unlike rejection sampling.
+
+    Vec2D u = sample_2D();
+    double a = 2 * u.x() - 1;
+    double b = 2 * u.y() - 1;
+
+    if (a == 0 && b == 0)
+        return {0, 0, 0};
+
+    double r, theta;
+    if (fabs(a) > fabs(b)) {
+        r = a;
+        theta = M_PI / 4 * (b / a);
+    } else {
+        r = b;
+        theta = M_PI / 2 - M_PI / 4 * (a / b);
+    }
+    double sin_theta, cos_theta;
+    Default_Math::sincos(theta, sin_theta, cos_theta);
+    return {r * cos_theta, r * sin_theta, 0};
+}
+
 inline Vec3D random_on_hemisphere(const Vec3D& normal) {
     // Returns a random vector on the unit hemisphere of directions.
 
@@ -77,12 +125,15 @@ inline Vec3D random_on_hemisphere(const Vec3D& normal) {
 
 // Peter Shirley's method to generate cosine-weighted directions
 inline Vec3D random_cosine_direction() {
-    auto r1 = random_double();
-    auto r2 = random_double();
+    Vec2D u = sample_2D();
+    auto r1 = u.x();
+    auto r2 = u.y();
 
     auto phi = 2*M_PI*r1;
-    auto x = cos(phi)*sqrt(r2);
-    auto y = sin(phi)*sqrt(r2);
+    double sin_phi, cos_phi;
+    Default_Math::sincos(phi, sin_phi, cos_phi);
+    auto x = cos_phi*sqrt(r2);
+    auto y = sin_phi*sqrt(r2);
     auto z = sqrt(1-r2);
    // std::cout << x << " " << y << " " << z << std::endl;
     return Vec3D(x, y, z);
@@ -91,28 +142,33 @@ inline Vec3D random_cosine_direction() {
 static int sin_called = 0;
 // My method
 inline Vec3D cosine_weighted_direction() {
-    double r1 = random_double();
-    double r2 = random_double();
+    Vec2D u = sample_2D();
+    double r1 = u.x();
+    double r2 = u.y();
 
     double phi = TWO_PI * r1;
     double sqrt_r2 = sqrt(r2);
-    double cos_phi = cos(phi);
+    double sin_phi, cos_phi;
+    Default_Math::sincos(phi, sin_phi, cos_phi);
    // sin_called++;
 
-    return {cos_phi * sqrt_r2, sin(phi) * sqrt_r2, sqrt(1.0 - r2)};
+    return {cos_phi * sqrt_r2, sin_phi * sqrt_r2, sqrt(1.0 - r2)};
 }
 
 inline Vec3D direction_on_hemisphere() {
     // Generates a uniformly distributed direction on the unit hemisphere
 
-    auto r1 = random_double();
+    Vec2D u = sample_2D();
+    auto r1 = u.x();
     auto phi = 2 * M_PI * r1;
 
-    auto r2 = random_double();
+    auto r2 = u.y();
 
     // Convert spherical coordinates to Cartesian coordinates
-    auto x = sqrt(1-(r2*r2)) * cos(phi);
-    auto y = sqrt(1-(r2*r2)) * sin(phi);
+    double sin_phi, cos_phi;
+    Default_Math::sincos(phi, sin_phi, cos_phi);
+    auto x = sqrt(1-(r2*r2)) * cos_phi;
+    auto y = sqrt(1-(r2*r2)) * sin_phi;
     auto z = 1 - r2;
 
 
@@ -13,16 +13,20 @@
 /// Reference:  Importance Sampling of the Phong Reflectance Model: https://www.cs.princeton.edu/courses/archive/fall16/cos526/papers/importance.pdf
 inline Vec3D weighted_direction(double specular_exponent) {
     // Generate two uniform random variables
-    double u1 = random_double();
-    double u2 = random_double();
+    Vec2D u = sample_2D();
+    double u1 = u.x();
+    double u2 = u.y();
 
     // Inverse transformation from CDF
     double phi = 2 * M_PI * u1;
-    double theta = acos(pow(u2, 1/(specular_exponent+1)));
+    // cos(theta) = u2^(1/(n+1)); sin(theta) follows from it, so theta itself is never needed
+    double z = Default_Math::pow(u2, 1/(specular_exponent+1));
+    double sin_theta = sin_from_cos(z);
 
-    double z = cos(theta);
-    double y = sin(phi) * sin(theta);
-    double x = cos(phi) * sin(theta);
+    double sin_phi, cos_phi;
+    Default_Math::sincos(phi, sin_phi, cos_phi);
+    double y = sin_phi * sin_theta;
+    double x = cos_phi * sin_theta;
   //  sin_called++; sin_called++; sin_called++;
 
     return {x, y, z};
@@ -32,23 +36,21 @@ class Specular_PDF : public PDF {
 public:
     // Constructor
     // -----------------------------------------------------------------------
-    Specular_PDF(const Vec3D& w_o, const Vec3D& normal, double shininess) : w_o(unit_vector(w_o)), normal(unit_vector(normal)), shininess(shininess) {
-        uvw = build_ONB(normal);
-    }
+    Specular_PDF(const Vec3D& w_o, const Vec3D& normal, double shininess) : w_o(unit_vector(w_o)), normal(unit_vector(normal)), shininess(shininess), uvw(normal) {}
 
     // Overridden Functions
     // -----------------------------------------------------------------------
     double PDF_value(const Vec3D& w_i) const override {
         // Calculates the angle between the incoming
         // direction (w_i) and the perfect reflection direction
-        double specular_cos_alpha = dot_product(specular_reflection_direction(uvw[2], normal), unit_vector(w_i));
+        double specular_cos_alpha = dot_product(specular_reflection_direction(uvw.w(), normal), unit_vector(w_i));
 
         // PDF for specular reflection
-        return fmax(0.0, (shininess + 1) * std::pow(specular_cos_alpha, shininess) / (2 * M_PI));
+        return fmax(0.0, (shininess + 1) * Default_Math::pow(specular_cos_alpha, shininess) / (2 * M_PI));
     }
 
     Vec3D generate_a_random_direction_based_on_PDF() const override {
-        return global_to_ONB_local(uvw, weighted_direction(shininess));
+        return uvw.to_world(weighted_direction(shininess));
     }
 
 private:
@@ -57,7 +59,7 @@ private:
     Vec3D w_o;                  // outgoing direction
     Vec3D normal;               // surface normal
     double shininess;           // how shiny the surface is
-    std::vector<Vec3D> uvw;     // orthonormal basis
+    ONB uvw;                    // orthonormal basis
 };
 
 
@@ -11,9 +11,7 @@ class Uniform_Hemispherical_PDF : public PDF {
 public:
     // Constructor
     // -----------------------------------------------------------------------
-    Uniform_Hemispherical_PDF(const Vec3D& intersection_normal) : intersection_normal(intersection_normal) {
-        uvw = build_ONB(intersection_normal);
-    }
+    Uniform_Hemispherical_PDF(const Vec3D& intersection_normal) : uvw(intersection_normal), intersection_normal(intersection_normal) {}
 
     // Overridden Functions
     // -----------------------------------------------------------------------
@@ -22,13 +20,13 @@ public:
     }
 
     Vec3D generate_a_random_direction_based_on_PDF() const override {
-        return global_to_ONB_local(uvw, direction_on_hemisphere());
+        return uvw.to_world(direction_on_hemisphere());
     }
 
 private:
     // Data Members
     // -----------------------------------------------------------------------
-    std::vector<Vec3D> uvw;
+    ONB uvw;
     Vec3D intersection_normal;
 };
 
@@ -49,6 +49,20 @@ public:
         return ray_origin + t * ray_direction - ray_direction * 0.0001;
     };
 
+    double cone_width_at(double t) const {
+        // Width of the ray cone at parameter t (0 if the ray carries no cone). Directions are not normalized
+        // (camera rays are focus_distance long, light samples end at t = 1), so the distance is t |d|.
+
+        if (cone_spread == 0.0)
+            return cone_width;
+        return cone_width + t * ray_direction.length() * cone_spread;
+    }
+
+    void set_cone(double width, double spread) {
+        cone_width = width;
+        cone_spread = spread;
+    }
+
     Vec3D get_inverse_direction() const {
         // Returns the inverse of the direction vector of the ray
 
@@ -63,6 +77,13 @@ public:
     double time;                    // the ray's time
     Vec3D inv_direction;
     int sign[3];
+
+    /// Reference: Texture Level of Detail Strategies for Real-Time Ray Tracing - Ray Tracing Gems, Chapter 20
+    // An optional ray cone, a cheap stand-in for ray differentials: the footprint of the ray is a cone
+    // that is cone_width wide at the origin and widens by cone_spread per unit of distance. The camera starts it
+    // with the angle subtended by a pixel; the integrators carry it through the bounces.
+    double cone_width = 0.0;
+    double cone_spread = 0.0;       // radians (small-angle: width grows by spread * distance)
 };
 
 
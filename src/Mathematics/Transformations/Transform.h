@@ -0,0 +1,121 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_TRANSFORM_H
+#define CUDA_RAY_TRACER_TRANSFORM_H
+
+#include "../../Primitives/Primitive.h"
+#include "../Matrix4x4.h"
+
+/// Reference: Fundamentals of Computer Graphics - Section 13.2: Instancing
+// A single affine transformation of a primitive. Unlike nesting Translate(Rotate_Y(...)), the whole
+// object-to-world matrix, its inverse and the normal matrix are computed once when the scene is built,
+// so a ray test costs one matrix/ray product and one call into the wrapped primitive.
+class Transform : public Primitive {
+public:
+    // Constructor
+    // -----------------------------------------------------------------------
+    Transform(std::shared_ptr<Primitive> primitive, const Matrix4x4& object_to_world) {
+        // If we are transforming an already transformed primitive, fold the two matrices
+        // together instead of nesting another wrapper.
+        std::shared_ptr<Transform> nested = std::dynamic_pointer_cast<Transform>(primitive);
+        if (nested) {
+            primitive_ptr = nested->primitive_ptr;
+            object_to_world_matrix = object_to_world * nested->object_to_world_matrix;
+        } else {
+            primitive_ptr = primitive;
+            object_to_world_matrix = object_to_world;
+        }
+
+        world_to_object_matrix = object_to_world_matrix.inverse();
+        normal_matrix = world_to_object_matrix.transpose_3x3();
+
+        // Texture footprints are per unit of object space length; a scaled object stretches its texture
+        // over the average scale factor, the cube root of the volume scale
+        uv_per_world_length = 1.0 / std::cbrt(std::fabs(object_to_world_matrix.determinant_3x3()));
+
+        // The box over the default shutter interval [0,1] is the one almost every caller asks for
+        has_bbox = primitive_ptr->has_bounding_box(0, 1, bbox);
+        if (has_bbox)
+            bbox = transform_AABB(bbox);
+    }
+
+    // Overloaded Functions
+    // -----------------------------------------------------------------------
+    bool intersection(const Ray &r, double t_0, double t_1, Intersection_Information &intersection_info) const override {
+        // Move the ray from world space to object space. The direction is not renormalized,
+        // so the t values found in object space are valid in world space as well.
+        Ray object_ray(world_to_object_matrix.transform_point(r.get_ray_origin()),
+                       world_to_object_matrix.transform_vector(r.get_ray_direction()),
+                       r.get_time());
+
+        if (!primitive_ptr->intersection(object_ray, t_0, t_1, intersection_info))
+            return false;
+
+        // Move the intersection point and the normal back to world space. The normal was already
+        // oriented against the object space ray, and (M^-1)^T keeps that orientation.
+        intersection_info.p = object_to_world_matrix.transform_point(intersection_info.p);
+        intersection_info.normal = unit_vector(normal_matrix.transform_vector(intersection_info.normal));
+        intersection_info.uv_per_unit_length *= uv_per_world_length;
+
+        return true;
+    }
+
+    bool has_bounding_box(double time_0, double time_1, AABB &surrounding_AABB) const override {
+        if (time_0 == 0 && time_1 == 1) {
+            surrounding_AABB = bbox;
+            return has_bbox;
+        }
+
+        // Another interval: a moving primitive covers a different region, so bound it again
+        if (!primitive_ptr->has_bounding_box(time_0, time_1, surrounding_AABB))
+            return false;
+        surrounding_AABB = transform_AABB(surrounding_AABB);
+        return true;
+    }
+
+    // Getters
+    // -----------------------------------------------------------------------
+    const Matrix4x4& get_object_to_world_matrix() const { return object_to_world_matrix; }
+
+private:
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    AABB transform_AABB(const AABB& box) const {
+        // Transforms the eight corners of the box and returns the box that bounds them
+
+        point3D min( infinity,  infinity,  infinity);
+        point3D max(-infinity, -infinity, -infinity);
+
+        for (int i = 0; i < 2; i++) {
+            for (int j = 0; j < 2; j++) {
+                for (int k = 0; k < 2; k++) {
+                    point3D corner(i ? box.get_max().x() : box.get_min().x(),
+                                   j ? box.get_max().y() : box.get_min().y(),
+                                   k ? box.get_max().z() : box.get_min().z());
+                    point3D tester = object_to_world_matrix.transform_point(corner);
+
+                    for (int c = 0; c < 3; c++) {
+                        min[c] = fmin(min[c], tester[c]);
+                        max[c] = fmax(max[c], tester[c]);
+                    }
+                }
+            }
+        }
+
+        return {min, max};
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    std::shared_ptr<Primitive> primitive_ptr;       // the transformed primitive (never another Transform)
+    Matrix4x4 object_to_world_matrix;               // object space -> world space
+    Matrix4x4 world_to_object_matrix;               // world space -> object space (cached inverse)
+    Matrix4x4 normal_matrix;                        // (object_to_world)^-T, for normals
+    double uv_per_world_length;                     // texture footprint scale: 1 / (average scale factor)
+    bool has_bbox;
+    AABB bbox;                                      // world space bounding box
+};
+
+#endif //CUDA_RAY_TRACER_TRANSFORM_H
@@ -6,14 +6,30 @@
 #define CUDA_RAY_TRACER_VEC3D_H
 
 #include "../Utilities.h"
+#include "Vec3D_SIMD.h"
 
+#ifdef VEC3D_PADDED
+class alignas(16) Vec3D {           // not 32: C++11 new and std::allocator only guarantee 16-byte alignment
+#else
 class Vec3D {
+#endif
 public:
     // Constructors
     // -----------------------------------------------------------------------
+#ifdef VEC3D_PADDED
+    // Built in registers: scalar stores followed by a vector load of the same Vec3D would stall the load
+    Vec3D() { store_lanes(V, set_lanes(0, 0, 0)); }
+
+    Vec3D(double v_x, double v_y, double v_z) { store_lanes(V, set_lanes(v_x, v_y, v_z)); }
+
+    explicit Vec3D(const Vec3D_Lanes& l) { store_lanes(V, l); }
+
+    Vec3D_Lanes lanes() const { return load_lanes(V); }
+#else
     Vec3D() : V{0, 0, 0} {}     // Default constructor
 
     Vec3D(double v_x, double v_y, double v_z) : V{v_x, v_y, v_z} {}
+#endif
 
     // Getters
     // -----------------------------------------------------------------------
@@ -25,6 +41,21 @@ public:
 
     // Overloaded operators
     // -----------------------------------------------------------------------
+#ifdef VEC3D_PADDED
+    Vec3D operator-() const { return Vec3D(negate_lanes(lanes())); }
+
+    Vec3D& operator+=(const Vec3D& v) {
+        store_lanes(V, add_lanes(lanes(), v.lanes()));
+
+        return* this;
+    }
+
+    Vec3D& operator*=(const double c) {
+        store_lanes(V, scale_lanes(lanes(), c));
+
+        return* this;
+    }
+#else
     Vec3D operator-() const { return Vec3D(-V[0], -V[1], -V[2]); }
 
     Vec3D& operator+=(const Vec3D& v) {
@@ -42,6 +73,7 @@ public:
 
         return* this;
     }
+#endif
 
     Vec3D operator/=(const double c) {
         return* this *= 1/c;        // reciprocal multiplication
@@ -53,13 +85,21 @@ public:
 
     // Vector operations
     // -----------------------------------------------------------------------
+#ifdef VEC3D_PADDED
+    double length_squared() const { return dot_lanes(lanes(), lanes()); }
+#else
     double length_squared() const { return V[0] * V[0] + V[1] * V[1] + V[2] * V[2]; }
+#endif
 
     double length() const { return std::sqrt(length_squared()); }
 public:
     // Data Members
     // -----------------------------------------------------------------------
+#ifdef VEC3D_PADDED
+    double V[4];                    // V[3] is padding, kept at 0
+#else
     double V[3];
+#endif
 };
 
 // Design Choice: make a point a vector (aliases)
@@ -69,6 +109,15 @@ using Color = Vec3D;
 
 // Cross product and dot product
 // ------------------------------------------------------------------------
+#ifdef VEC3D_PADDED
+inline double dot_product(const Vec3D& u, const Vec3D& v) {
+    return dot_lanes(u.lanes(), v.lanes());
+}
+
+inline Vec3D cross_product(const Vec3D& u, const Vec3D& v) {
+    return Vec3D(cross_lanes(u.lanes(), v.lanes()));
+}
+#else
 inline double dot_product(const Vec3D& u, const Vec3D& v) {
     return u[0] * v[0] + u[1] * v[1] + u[2] * v[2];
 }
@@ -80,6 +129,7 @@ inline Vec3D cross_product(const Vec3D& u, const Vec3D& v) {
             u[0] * v[1] - u[1] * v[0]
     );
 }
+#endif
 
 // Other vector operations
 // ------------------------------------------------------------------------
@@ -87,31 +137,50 @@ inline std::ostream& operator<<(std::ostream& out, const Vec3D& v) {
     return std::cout << v[0] << " " << v[1] << " " << v[2] << std::endl;
 }
 
+#ifdef VEC3D_PADDED
 inline Vec3D operator+(const Vec3D& u, const Vec3D& v) {
-    return {u[0] + v[0], u[1] + v[1], u[2] + v[2]};
+    return Vec3D(add_lanes(u.lanes(), v.lanes()));
 }
 
 inline Vec3D operator-(const Vec3D& u, const Vec3D& v) {
-    return {u[0] - v[0], u[1] - v[1], u[2] - v[2]};
+    return Vec3D(subtract_lanes(u.lanes(), v.lanes()));
 }
 
 inline Vec3D operator*(const Vec3D u, const Vec3D& v) {
-    return {u[0] * v[0], u[1] * v[1], u[2] * v[2]};
+    return Vec3D(multiply_lanes(u.lanes(), v.lanes()));
 }
 
 inline Vec3D operator*(double t, const Vec3D& v) {
-    return {t * v[0], t * v[1], t * v[2]};
+    return Vec3D(scale_lanes(v.lanes(), t));
 }
 
-inline Vec3D operator*(const Vec3D& v, double t) {
-    return t * v;
+inline Vec3D min(const Vec3D& a, const Vec3D& b) {
+    return Vec3D(min_lanes(a.lanes(), b.lanes()));
 }
 
-inline Vec3D operator/(Vec3D v, double t) {
-    return (1 / t) * v;
+inline Vec3D max(const Vec3D& a, const Vec3D& b) {
+    return Vec3D(max_lanes(a.lanes(), b.lanes()));
 }
 
-inline Vec3D unit_vector(Vec3D v) { return v / v.length(); }
+inline Vec3D rcp(const Vec3D& v) {
+    return Vec3D(reciprocal_lanes(v.lanes()));
+}
+#else
+inline Vec3D operator+(const Vec3D& u, const Vec3D& v) {
+    return {u[0] + v[0], u[1] + v[1], u[2] + v[2]};
+}
+
+inline Vec3D operator-(const Vec3D& u, const Vec3D& v) {
+    return {u[0] - v[0], u[1] - v[1], u[2] - v[2]};
+}
+
+inline Vec3D operator*(const Vec3D u, const Vec3D& v) {
+    return {u[0] * v[0], u[1] * v[1], u[2] * v[2]};
+}
+
+inline Vec3D operator*(double t, const Vec3D& v) {
+    return {t * v[0], t * v[1], t * v[2]};
+}
 
 inline Vec3D min(const Vec3D& a, const Vec3D& b) {
     return { fmin(a.x(), b.x()), fmin(a.y(), b.y()), fmin(a.z(), b.z()) };
@@ -124,5 +193,16 @@ inline Vec3D max(const Vec3D& a, const Vec3D& b) {
 inline Vec3D rcp(const Vec3D& v) {
     return { 1.0f / v.x(), 1.0f / v.y(), 1.0f / v.z() };
 }
+#endif
+
+inline Vec3D operator*(const Vec3D& v, double t) {
+    return t * v;
+}
+
+inline Vec3D operator/(Vec3D v, double t) {
+    return (1 / t) * v;
+}
+
+inline Vec3D unit_vector(Vec3D v) { return v / v.length(); }
 
 #endif //CUDA_RAY_TRACER_VEC3D_H
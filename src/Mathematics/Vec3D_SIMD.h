@@ -0,0 +1,172 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_VEC3D_SIMD_H
+#define CUDA_RAY_TRACER_VEC3D_SIMD_H
+
+#include <cmath>
+
+/// Reference: Intel Intrinsics Guide - https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
+// The SIMD backends of Vec3D. Compiled with VEC3D_SIMD=1 (CMake option VEC3D_SIMD), a Vec3D holds a
+// fourth, always-zero lane and its operators work on all four lanes at once: one AVX register with AVX2
+// enabled (e.g. -mavx2), otherwise two SSE2 registers (xy and zw). Without VEC3D_SIMD, or on a CPU with
+// neither, Vec3D stays three scalar doubles and none of this is used.
+//
+// Every operator rounds exactly like the scalar one, lane by lane: dot products add (x*x + y*y) + z*z in
+// that order, and min/max follow fmin/fmax when one side is a NaN. Images are therefore the same with and
+// without SIMD. A padded Vec3D is 32 bytes aligned to 16: C++11 new and containers don't honour a stricter
+// alignment, and the compiler would otherwise move Vec3Ds with aligned AVX instructions that fault. AVX loads
+// and stores are therefore unaligned ones.
+// -----------------------------------------------------------------------
+#if defined(VEC3D_SIMD) && VEC3D_SIMD && defined(__AVX2__)
+#define VEC3D_SIMD_AVX2
+#include <immintrin.h>
+#elif defined(VEC3D_SIMD) && VEC3D_SIMD && defined(__SSE2__)
+#define VEC3D_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(VEC3D_SIMD_AVX2) || defined(VEC3D_SIMD_SSE2)
+#define VEC3D_PADDED                    // Vec3D::V has 4 lanes
+#endif
+
+inline const char* Vec3D_backend_name() {
+#if defined(VEC3D_SIMD_AVX2)
+    return "avx2";
+#elif defined(VEC3D_SIMD_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+#if defined(VEC3D_SIMD_AVX2)
+// AVX2: x, y, z, 0 in one register
+// -----------------------------------------------------------------------
+struct Vec3D_Lanes {
+    __m256d xyzw;
+};
+
+inline Vec3D_Lanes set_lanes(double x, double y, double z) { return {_mm256_set_pd(0.0, z, y, x)}; }
+
+inline Vec3D_Lanes load_lanes(const double* v) { return {_mm256_loadu_pd(v)}; }
+
+inline void store_lanes(double* v, const Vec3D_Lanes& a) { _mm256_storeu_pd(v, a.xyzw); }
+
+inline Vec3D_Lanes add_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) { return {_mm256_add_pd(a.xyzw, b.xyzw)}; }
+
+inline Vec3D_Lanes subtract_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) { return {_mm256_sub_pd(a.xyzw, b.xyzw)}; }
+
+inline Vec3D_Lanes multiply_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) { return {_mm256_mul_pd(a.xyzw, b.xyzw)}; }
+
+inline Vec3D_Lanes scale_lanes(const Vec3D_Lanes& a, double c) { return {_mm256_mul_pd(a.xyzw, _mm256_set1_pd(c))}; }
+
+inline Vec3D_Lanes negate_lanes(const Vec3D_Lanes& a) { return {_mm256_xor_pd(a.xyzw, _mm256_set1_pd(-0.0))}; }
+
+inline Vec3D_Lanes reciprocal_lanes(const Vec3D_Lanes& a) {
+    // 1/0 in the padding lane would be +inf; keep it 0
+    __m256d r = _mm256_div_pd(_mm256_set1_pd(1.0), a.xyzw);
+    return {_mm256_blend_pd(r, _mm256_setzero_pd(), 0x8)};
+}
+
+inline Vec3D_Lanes min_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) {
+    // fmin: a NaN on one side gives the other side (_mm256_min_pd alone returns b)
+    __m256d m = _mm256_min_pd(a.xyzw, b.xyzw);
+    return {_mm256_blendv_pd(m, a.xyzw, _mm256_cmp_pd(b.xyzw, b.xyzw, _CMP_UNORD_Q))};
+}
+
+inline Vec3D_Lanes max_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) {
+    __m256d m = _mm256_max_pd(a.xyzw, b.xyzw);
+    return {_mm256_blendv_pd(m, a.xyzw, _mm256_cmp_pd(b.xyzw, b.xyzw, _CMP_UNORD_Q))};
+}
+
+inline double dot_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) {
+    __m256d p = _mm256_mul_pd(a.xyzw, b.xyzw);
+    __m128d xy = _mm256_castpd256_pd128(p);
+    __m128d zw = _mm256_extractf128_pd(p, 1);
+    __m128d s = _mm_add_sd(xy, _mm_unpackhi_pd(xy, xy));
+    return _mm_cvtsd_f64(_mm_add_sd(s, zw));
+}
+
+inline Vec3D_Lanes cross_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) {
+    // a.yzx * b.zxy - a.zxy * b.yzx; the padding lane comes out as w*w - w*w = 0
+    __m256d a_yzx = _mm256_permute4x64_pd(a.xyzw, _MM_SHUFFLE(3, 0, 2, 1));
+    __m256d a_zxy = _mm256_permute4x64_pd(a.xyzw, _MM_SHUFFLE(3, 1, 0, 2));
+    __m256d b_yzx = _mm256_permute4x64_pd(b.xyzw, _MM_SHUFFLE(3, 0, 2, 1));
+    __m256d b_zxy = _mm256_permute4x64_pd(b.xyzw, _MM_SHUFFLE(3, 1, 0, 2));
+    return {_mm256_sub_pd(_mm256_mul_pd(a_yzx, b_zxy), _mm256_mul_pd(a_zxy, b_yzx))};
+}
+
+#elif defined(VEC3D_SIMD_SSE2)
+// SSE2: x, y in one register and z, 0 in another
+// -----------------------------------------------------------------------
+struct Vec3D_Lanes {
+    __m128d xy;
+    __m128d zw;
+};
+
+inline Vec3D_Lanes set_lanes(double x, double y, double z) { return {_mm_set_pd(y, x), _mm_set_sd(z)}; }
+
+inline Vec3D_Lanes load_lanes(const double* v) { return {_mm_loadu_pd(v), _mm_loadu_pd(v + 2)}; }
+
+inline void store_lanes(double* v, const Vec3D_Lanes& a) {
+    _mm_storeu_pd(v, a.xy);
+    _mm_storeu_pd(v + 2, a.zw);
+}
+
+inline Vec3D_Lanes add_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) { return {_mm_add_pd(a.xy, b.xy), _mm_add_pd(a.zw, b.zw)}; }
+
+inline Vec3D_Lanes subtract_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) { return {_mm_sub_pd(a.xy, b.xy), _mm_sub_pd(a.zw, b.zw)}; }
+
+inline Vec3D_Lanes multiply_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) { return {_mm_mul_pd(a.xy, b.xy), _mm_mul_pd(a.zw, b.zw)}; }
+
+inline Vec3D_Lanes scale_lanes(const Vec3D_Lanes& a, double c) {
+    __m128d s = _mm_set1_pd(c);
+    return {_mm_mul_pd(a.xy, s), _mm_mul_pd(a.zw, s)};
+}
+
+inline Vec3D_Lanes negate_lanes(const Vec3D_Lanes& a) {
+    __m128d sign = _mm_set1_pd(-0.0);
+    return {_mm_xor_pd(a.xy, sign), _mm_xor_pd(a.zw, sign)};
+}
+
+inline Vec3D_Lanes reciprocal_lanes(const Vec3D_Lanes& a) {
+    __m128d one = _mm_set1_pd(1.0);
+    return {_mm_div_pd(one, a.xy), _mm_move_sd(_mm_setzero_pd(), _mm_div_sd(one, a.zw))};
+}
+
+inline __m128d fmin_pd(__m128d a, __m128d b) {
+    // fmin: a NaN on one side gives the other side (_mm_min_pd alone returns b)
+    __m128d b_is_nan = _mm_cmpunord_pd(b, b);
+    return _mm_or_pd(_mm_and_pd(b_is_nan, a), _mm_andnot_pd(b_is_nan, _mm_min_pd(a, b)));
+}
+
+inline __m128d fmax_pd(__m128d a, __m128d b) {
+    __m128d b_is_nan = _mm_cmpunord_pd(b, b);
+    return _mm_or_pd(_mm_and_pd(b_is_nan, a), _mm_andnot_pd(b_is_nan, _mm_max_pd(a, b)));
+}
+
+inline Vec3D_Lanes min_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) { return {fmin_pd(a.xy, b.xy), fmin_pd(a.zw, b.zw)}; }
+
+inline Vec3D_Lanes max_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) { return {fmax_pd(a.xy, b.xy), fmax_pd(a.zw, b.zw)}; }
+
+inline double dot_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) {
+    __m128d xy = _mm_mul_pd(a.xy, b.xy);
+    __m128d s = _mm_add_sd(xy, _mm_unpackhi_pd(xy, xy));
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_mul_sd(a.zw, b.zw)));
+}
+
+inline Vec3D_Lanes cross_lanes(const Vec3D_Lanes& a, const Vec3D_Lanes& b) {
+    // a.yzx * b.zxy - a.zxy * b.yzx, on (y,z | x) and (z,x | y); the padding lane is cleared
+    __m128d a_yz = _mm_shuffle_pd(a.xy, a.zw, 1);
+    __m128d a_zx = _mm_shuffle_pd(a.zw, a.xy, 0);
+    __m128d b_yz = _mm_shuffle_pd(b.xy, b.zw, 1);
+    __m128d b_zx = _mm_shuffle_pd(b.zw, b.xy, 0);
+    __m128d xy = _mm_sub_pd(_mm_mul_pd(a_yz, b_zx), _mm_mul_pd(a_zx, b_yz));
+    __m128d z = _mm_sub_sd(_mm_mul_sd(a.xy, _mm_unpackhi_pd(b.xy, b.xy)), _mm_mul_sd(_mm_unpackhi_pd(a.xy, a.xy), b.xy));
+    return {xy, _mm_move_sd(_mm_setzero_pd(), z)};
+}
+#endif
+
+#endif //CUDA_RAY_TRACER_VEC3D_SIMD_H
@@ -0,0 +1,169 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_MEMORY_ARENA_H
+#define CUDA_RAY_TRACER_MEMORY_ARENA_H
+
+#include "Utilities.h"
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/// Reference: Physically Based Rendering (4th ed.) - Appendix B.4.2: Memory Arenas (ScratchBuffer)
+// A bump allocator for the many small objects of a scene (mesh triangles, BVH nodes). Objects are carved out
+// of large blocks one after the other and are all freed at once, with the arena, instead of one heap block
+// (and, with std::make_shared, one reference count) each. Objects made together sit next to each other in
+// memory, which is also the order the BVH builders visit them in.
+//
+// Each thread bumps its own block, so parallel builders (OpenMP tasks included) allocate without locking;
+// only a thread's first allocation from an arena takes a lock, to get its blocks.
+//
+//      std::shared_ptr<Memory_Arena> arena = std::make_shared<Memory_Arena>();
+//      std::shared_ptr<Triangle> t = arena->make_shared<Triangle>(a, b, c, material);   // no heap block of its own
+//      Node* n = arena->make<Node>(...);                                             // non-owning
+//
+// make_shared() returns a std::shared_ptr that shares the arena's reference count, so the arena lives as long
+// as any object made that way; make() returns a plain pointer that is only valid while the arena is.
+// Destructors are run, in reverse order, when the arena is destroyed.
+// -----------------------------------------------------------------------
+class Memory_Arena : public std::enable_shared_from_this<Memory_Arena> {
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    explicit Memory_Arena(size_t block_size = 256 * 1024) : block_size(block_size), id(next_id()) {}
+
+    Memory_Arena(const Memory_Arena&) = delete;
+    Memory_Arena& operator=(const Memory_Arena&) = delete;
+
+    ~Memory_Arena() {
+        for (Thread_Blocks& t : threads)
+            t.release();
+    }
+
+    // Allocation
+    // -----------------------------------------------------------------------
+    template <typename T, typename... Args>
+    T* make(Args&&... args) {
+        Thread_Blocks& t = blocks_of_this_thread();
+        void* memory = t.allocate(sizeof(T), alignof(T), block_size);
+        T* object = new (memory) T(std::forward<Args>(args)...);
+        if (!std::is_trivially_destructible<T>::value)
+            t.destructors.push_back({object, [](void* p) { static_cast<T*>(p)->~T(); }});
+        return object;
+    }
+
+    template <typename T, typename... Args>
+    std::shared_ptr<T> make_shared(Args&&... args) {
+        // Only for arenas that are themselves owned by a std::shared_ptr
+
+        return std::shared_ptr<T>(shared_from_this(), make<T>(std::forward<Args>(args)...));
+    }
+
+    // Statistics
+    // -----------------------------------------------------------------------
+    size_t bytes_used() const {
+        // Bytes handed out so far
+
+        size_t bytes = 0;
+        for (const Thread_Blocks& t : threads)
+            bytes += t.used;
+        return bytes;
+    }
+
+    size_t bytes_reserved() const {
+        // Bytes taken from the heap, including the unused ends of the blocks
+
+        size_t bytes = 0;
+        for (const Thread_Blocks& t : threads)
+            bytes += t.reserved;
+        return bytes;
+    }
+
+private:
+    // Supporting Types and Functions
+    // -----------------------------------------------------------------------
+    struct Destructor {
+        void* object;
+        void (*destroy)(void*);
+    };
+
+    struct Thread_Blocks {
+        std::thread::id owner;
+        std::vector<char*> blocks;
+        char* current = nullptr;            // next free byte of the last block
+        size_t remaining = 0;               // bytes left in the last block
+        size_t used = 0;
+        size_t reserved = 0;
+        std::vector<Destructor> destructors;
+        char padding[64];                   // keep the threads' bump pointers on separate cache lines
+
+        void* allocate(size_t size, size_t alignment, size_t block_size) {
+            size_t adjustment = (alignment - reinterpret_cast<uintptr_t>(current) % alignment) % alignment;
+            if (current == nullptr || adjustment + size > remaining) {
+                // Objects bigger than a block get a block of their own
+                size_t new_block_size = std::max(block_size, size + alignment);
+                current = static_cast<char*>(::operator new(new_block_size));
+                blocks.push_back(current);
+                remaining = new_block_size;
+                reserved += new_block_size;
+                adjustment = (alignment - reinterpret_cast<uintptr_t>(current) % alignment) % alignment;
+            }
+
+            char* p = current + adjustment;
+            current = p + size;
+            remaining -= adjustment + size;
+            used += size;
+            return p;
+        }
+
+        void release() {
+            for (auto d = destructors.rbegin(); d != destructors.rend(); ++d)
+                d->destroy(d->object);
+            for (char* block : blocks)
+                ::operator delete(block);
+            destructors.clear();
+            blocks.clear();
+        }
+    };
+
+    Thread_Blocks& blocks_of_this_thread() {
+        // Each thread remembers its blocks in the arena it used last, which is nearly always this one. Arenas
+        // are told apart by id rather than address, since a new arena may reuse a freed one's address.
+
+        struct Last_Used {
+            uint64_t arena_id = 0;
+            Thread_Blocks* blocks = nullptr;
+        };
+        static thread_local Last_Used last_used;
+
+        if (last_used.arena_id != id) {
+            std::lock_guard<std::mutex> lock(threads_mutex);
+            std::thread::id me = std::this_thread::get_id();
+            auto mine = std::find_if(threads.begin(), threads.end(), [me](const Thread_Blocks& t) { return t.owner == me; });
+            if (mine == threads.end()) {
+                threads.emplace_back();
+                threads.back().owner = me;
+                mine = threads.end() - 1;
+            }
+            last_used.arena_id = id;
+            last_used.blocks = &*mine;
+        }
+        return *last_used.blocks;
+    }
+
+    static uint64_t next_id() {
+        static std::atomic<uint64_t> ids(0);
+        return ++ids;
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    size_t block_size;
+    uint64_t id;                                // never 0
+    std::deque<Thread_Blocks> threads;          // one per thread that allocated; a deque keeps them in place
+    std::mutex threads_mutex;
+};
+
+#endif //CUDA_RAY_TRACER_MEMORY_ARENA_H
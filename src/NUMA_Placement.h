@@ -0,0 +1,396 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_NUMA_PLACEMENT_H
+#define CUDA_RAY_TRACER_NUMA_PLACEMENT_H
+
+#include "Utilities.h"
+#include "Primitives/Primitive.h"
+#include <thread>
+
+#ifdef __linux__
+#include <sched.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+/// Reference: Ulrich Drepper - What Every Programmer Should Know About Memory: Section 5 (NUMA Support)
+/// Reference: OpenMP 4.0 Specification - Section 2.5.2: Controlling OpenMP Thread Affinity (OMP_PLACES, OMP_PROC_BIND)
+// Where the render threads run and where the scene's memory lives on machines with several NUMA nodes
+// (sockets). Linux places a page on the node of the thread that first writes it, so a scene built by the
+// main thread sits entirely on its node, and render threads on the other socket read all of it remotely.
+//
+//      Thread affinity     none: the OS moves threads around (the default)
+//                          compact: thread i on the i-th CPU, filling a node before moving to the next
+//                          spread: thread i on node i % nodes, so every node gets the same number of threads
+//      Memory placement    first_touch: pages go where they are first written (the default)
+//                          interleave: the scene's pages are spread round-robin over the nodes while it is built
+//                          replicate: one copy of the BVH per node, built by a thread of that node; render
+//                          threads traverse the copy of their own node (see NUMA_Replicated_Primitive)
+//
+// Only the BVH is replicated: builders that keep pointers to the scene's primitives (BVH, BVH_Fast,
+// BVH_Parallel) still share the triangles, BVH_Flat copies them into its own arrays and is replicated whole.
+// The libgomp equivalent of the affinities is OMP_PLACES=cores with OMP_PROC_BIND=close or spread; this
+// header does the same without environment variables, and without libnuma (it reads /sys and calls
+// set_mempolicy directly). On other systems, or with a single node, everything below is a no-op.
+// -----------------------------------------------------------------------
+enum THREAD_AFFINITY {
+    AFFINITY_NONE,
+    AFFINITY_COMPACT,
+    AFFINITY_SPREAD
+};
+
+enum MEMORY_PLACEMENT {
+    PLACEMENT_FIRST_TOUCH,
+    PLACEMENT_INTERLEAVE,
+    PLACEMENT_REPLICATE
+};
+
+inline const char* thread_affinity_name(THREAD_AFFINITY a) {
+    switch (a) {
+        case AFFINITY_NONE: return "none";
+        case AFFINITY_COMPACT: return "compact";
+        case AFFINITY_SPREAD: return "spread";
+    }
+    return "?";
+}
+
+inline const char* memory_placement_name(MEMORY_PLACEMENT p) {
+    switch (p) {
+        case PLACEMENT_FIRST_TOUCH: return "first_touch";
+        case PLACEMENT_INTERLEAVE: return "interleave";
+        case PLACEMENT_REPLICATE: return "replicate";
+    }
+    return "?";
+}
+
+inline bool parse_thread_affinity(const std::string& name, THREAD_AFFINITY& a) {
+    for (int i = AFFINITY_NONE; i <= AFFINITY_SPREAD; i++) {
+        if (name == thread_affinity_name(static_cast<THREAD_AFFINITY>(i))) {
+            a = static_cast<THREAD_AFFINITY>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool parse_memory_placement(const std::string& name, MEMORY_PLACEMENT& p) {
+    for (int i = PLACEMENT_FIRST_TOUCH; i <= PLACEMENT_REPLICATE; i++) {
+        if (name == memory_placement_name(static_cast<MEMORY_PLACEMENT>(i))) {
+            p = static_cast<MEMORY_PLACEMENT>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// NUMA Topology
+// -----------------------------------------------------------------------
+struct NUMA_Topology {
+    // The nodes and the CPUs of each node that this process may run on. Without /sys (or outside Linux) the
+    // machine is one node holding every hardware thread.
+
+    std::vector<std::vector<int>> node_CPUs;        // CPUs of each node, in increasing order
+    std::vector<int> node_IDs;                      // the kernel's number of each node (node_CPUs[k] is node node_IDs[k])
+    std::vector<int> CPU_to_node;                   // index into node_CPUs, -1 for CPUs not in any node
+
+    int number_of_nodes() const { return static_cast<int>(node_CPUs.size()); }
+
+    int node_of_CPU(int cpu) const {
+        if (cpu < 0 || cpu >= static_cast<int>(CPU_to_node.size()) || CPU_to_node[cpu] < 0)
+            return 0;
+        return CPU_to_node[cpu];
+    }
+};
+
+inline std::vector<int> parse_CPU_list(const std::string& list) {
+    // "0-3,8-11" -> 0 1 2 3 8 9 10 11 (the format of /sys/devices/system/node/node*/cpulist)
+
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty() || range == "\n")
+            continue;
+        size_t dash = range.find('-');
+        int first = std::atoi(range.substr(0, dash).c_str());
+        int last = (dash == std::string::npos) ? first : std::atoi(range.substr(dash + 1).c_str());
+        for (int cpu = first; cpu <= last; cpu++)
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+inline NUMA_Topology read_NUMA_topology() {
+    NUMA_Topology topology;
+
+#ifdef __linux__
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    bool have_allowed = (sched_getaffinity(0, sizeof(allowed), &allowed) == 0);
+
+    DIR* dir = opendir("/sys/devices/system/node");
+    if (dir) {
+        std::vector<int> ids;
+        while (dirent* entry = readdir(dir)) {
+            std::string name = entry->d_name;
+            if (name.size() > 4 && name.compare(0, 4, "node") == 0 && std::isdigit(name[4]))
+                ids.push_back(std::atoi(name.c_str() + 4));
+        }
+        closedir(dir);
+        std::sort(ids.begin(), ids.end());
+
+        for (int id : ids) {
+            std::ifstream ifs("/sys/devices/system/node/node" + std::to_string(id) + "/cpulist");
+            std::string list;
+            std::getline(ifs, list);
+
+            std::vector<int> cpus;
+            for (int cpu : parse_CPU_list(list))
+                if (!have_allowed || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)))
+                    cpus.push_back(cpu);
+            if (cpus.empty())
+                continue;           // memory-only nodes, or nodes this process may not run on
+            topology.node_CPUs.push_back(cpus);
+            topology.node_IDs.push_back(id);
+        }
+    }
+
+    if (topology.node_CPUs.empty() && have_allowed) {
+        std::vector<int> cpus;
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            if (CPU_ISSET(cpu, &allowed))
+                cpus.push_back(cpu);
+        if (!cpus.empty()) {
+            topology.node_CPUs.push_back(cpus);
+            topology.node_IDs.push_back(0);
+        }
+    }
+#endif
+
+    if (topology.node_CPUs.empty()) {
+        unsigned int n = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<int> cpus;
+        for (unsigned int cpu = 0; cpu < n; cpu++)
+            cpus.push_back(static_cast<int>(cpu));
+        topology.node_CPUs.push_back(cpus);
+        topology.node_IDs.push_back(0);
+    }
+
+    for (int node = 0; node < topology.number_of_nodes(); node++) {
+        for (int cpu : topology.node_CPUs[node]) {
+            if (cpu >= static_cast<int>(topology.CPU_to_node.size()))
+                topology.CPU_to_node.resize(cpu + 1, -1);
+            topology.CPU_to_node[cpu] = node;
+        }
+    }
+    return topology;
+}
+
+inline const NUMA_Topology& NUMA_topology() {
+    // Read once; the CPUs this process may use are taken from its affinity mask at that moment
+
+    static NUMA_Topology topology = read_NUMA_topology();
+    return topology;
+}
+
+// Thread Affinity
+// -----------------------------------------------------------------------
+inline int& pinned_NUMA_node() {
+    // The node this thread was pinned to by pin_this_thread(), -1 if it is not pinned
+
+    static thread_local int node = -1;
+    return node;
+}
+
+inline int current_NUMA_node() {
+    // The node this thread runs on (an index into NUMA_topology().node_CPUs)
+
+    int node = pinned_NUMA_node();
+    if (node >= 0)
+        return node;
+#ifdef __linux__
+    return NUMA_topology().node_of_CPU(sched_getcpu());
+#else
+    return 0;
+#endif
+}
+
+inline bool pin_this_thread(const std::vector<int>& cpus, int node) {
+    // Restricts the calling thread to "cpus", all of which belong to "node"
+
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+        CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0)
+        return false;
+    pinned_NUMA_node() = node;
+    return true;
+#else
+    return false;
+#endif
+}
+
+inline std::vector<int> affinity_CPU_order(THREAD_AFFINITY affinity) {
+    // The CPU of each thread, thread i getting order[i % order.size()]
+
+    const NUMA_Topology& topology = NUMA_topology();
+    std::vector<int> order;
+
+    if (affinity == AFFINITY_COMPACT) {
+        for (const std::vector<int>& cpus : topology.node_CPUs)
+            order.insert(order.end(), cpus.begin(), cpus.end());
+    } else if (affinity == AFFINITY_SPREAD) {
+        size_t longest = 0;
+        for (const std::vector<int>& cpus : topology.node_CPUs)
+            longest = std::max(longest, cpus.size());
+        for (size_t k = 0; k < longest; k++)
+            for (const std::vector<int>& cpus : topology.node_CPUs)
+                if (k < cpus.size())
+                    order.push_back(cpus[k]);
+    }
+    return order;
+}
+
+inline void pin_render_threads(THREAD_AFFINITY affinity, int num_threads) {
+    // Pins the threads of the OpenMP thread pool, as used by a "#pragma omp parallel num_threads(num_threads)"
+    // (the renderers' loops), one CPU each. libgomp keeps the pool's threads between parallel regions, so
+    // they stay pinned for every later region with at most num_threads threads, the main thread included.
+
+    if (affinity == AFFINITY_NONE)
+        return;
+
+    std::vector<int> order = affinity_CPU_order(affinity);
+    const NUMA_Topology& topology = NUMA_topology();
+    int failures = 0;
+
+#pragma omp parallel num_threads(num_threads) reduction(+:failures)
+    {
+        int cpu = order[omp_get_thread_num() % order.size()];
+        if (!pin_this_thread(std::vector<int>(1, cpu), topology.node_of_CPU(cpu)))
+            failures++;
+    }
+
+    if (failures > 0)
+        std::cerr << "COULD NOT PIN " << failures << " OF " << num_threads << " THREADS; THEY RUN UNPINNED\n";
+}
+
+// Memory Placement
+// -----------------------------------------------------------------------
+class Interleaved_Memory_Scope {
+    // While an object of this class lives, the pages the calling thread touches first are spread round-robin
+    // over all nodes (set_mempolicy(MPOL_INTERLEAVE)), so that no node serves all the scene's memory.
+    // The policy is per thread: threads started by the scene's builders keep the default policy.
+
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    Interleaved_Memory_Scope() {
+#ifdef __linux__
+        const NUMA_Topology& topology = NUMA_topology();
+        if (topology.number_of_nodes() < 2)
+            return;
+
+        unsigned long mask[16] = {};
+        const unsigned long bits = 8 * sizeof(unsigned long);
+        for (int id : topology.node_IDs)
+            if (id < static_cast<int>(16 * bits))
+                mask[id / bits] |= 1ul << (id % bits);
+        active = (syscall(SYS_set_mempolicy, MPOL_INTERLEAVE, mask, 16 * bits) == 0);
+        if (!active)
+            std::cerr << "COULD NOT INTERLEAVE THE SCENE'S MEMORY; IT IS PLACED ON FIRST TOUCH\n";
+#endif
+    }
+
+    Interleaved_Memory_Scope(const Interleaved_Memory_Scope&) = delete;
+    Interleaved_Memory_Scope& operator=(const Interleaved_Memory_Scope&) = delete;
+
+    ~Interleaved_Memory_Scope() {
+#ifdef __linux__
+        if (active)
+            syscall(SYS_set_mempolicy, MPOL_DEFAULT, nullptr, 0);
+#endif
+    }
+
+private:
+    // Numeric values of <linux/mempolicy.h>, so that neither it nor libnuma is needed
+    static const int MPOL_DEFAULT = 0;
+    static const int MPOL_INTERLEAVE = 3;
+
+    bool active = false;
+};
+
+inline bool& replicate_BVH_per_NUMA_node() {
+    // When set, build_BVH() builds one BVH per node (see NUMA_Replicated_Primitive)
+
+    static bool replicate = false;
+    return replicate;
+}
+
+template <typename Build>
+std::vector<std::shared_ptr<Primitive>> build_on_every_NUMA_node(const Build& build) {
+    // Runs build() once per node, on a thread restricted to that node's CPUs, so that the memory it writes
+    // (and the threads it starts, which inherit the restriction) is local to that node
+
+    const NUMA_Topology& topology = NUMA_topology();
+    std::vector<std::shared_ptr<Primitive>> replicas(topology.number_of_nodes());
+
+    for (int node = 0; node < topology.number_of_nodes(); node++) {
+        std::thread builder([&, node]() {
+            pin_this_thread(topology.node_CPUs[node], node);
+            replicas[node] = build();
+        });
+        builder.join();
+    }
+    return replicas;
+}
+
+class NUMA_Replicated_Primitive : public Primitive {
+    // The same primitive (a BVH) built once per node. Each ray is traced through the copy of the node that
+    // the tracing thread runs on: the node it was pinned to, or else the node of the CPU it is on right now.
+
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    explicit NUMA_Replicated_Primitive(std::vector<std::shared_ptr<Primitive>> replicas) : replicas(std::move(replicas)) {}
+
+    // Overloaded Functions
+    // -----------------------------------------------------------------------
+    bool intersection(const Ray& r, double t_0, double t_1, Intersection_Information& intersection_info) const override {
+        return local_replica().intersection(r, t_0, t_1, intersection_info);
+    }
+
+    bool has_bounding_box(double time_0, double time_1, AABB& surrounding_AABB) const override {
+        return replicas[0]->has_bounding_box(time_0, time_1, surrounding_AABB);
+    }
+
+    double PDF_value(const point3D& o, const Vec3D& v) const override {
+        return local_replica().PDF_value(o, v);
+    }
+
+    Vec3D random(const Vec3D& o) const override {
+        return local_replica().random(o);
+    }
+
+    double get_area() const override {
+        return replicas[0]->get_area();
+    }
+
+    int number_of_replicas() const { return static_cast<int>(replicas.size()); }
+
+private:
+    const Primitive& local_replica() const {
+        int node = current_NUMA_node();
+        return *replicas[node < static_cast<int>(replicas.size()) ? node : 0];
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    std::vector<std::shared_ptr<Primitive>> replicas;       // replicas[k] was built on node k
+};
+
+#endif //CUDA_RAY_TRACER_NUMA_PLACEMENT_H
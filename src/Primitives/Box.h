@@ -6,10 +6,6 @@
 #define CUDA_RAY_TRACER_BOX_H
 
 #include "Primitive.h"
-#include "Primitives_Group.h"
-#include "XZ_Rectangle.h"
-#include "XY_Rectangle.h"
-#include "YZ_Rectangle.h"
 
 class Box : public Primitive {
 public:
@@ -17,49 +13,68 @@ public:
 
     Box(const Vec3D& min_point, const Vec3D& max_point, const std::shared_ptr<Material>& mat_ptr) :
             min_point(min_point), max_point(max_point), mat_ptr(mat_ptr) {
-
-        box_sides = std::make_shared<Primitives_Group>();
-
-        box_sides->add_primitive_to_list(std::make_shared<XY_Rectangle>(
-                min_point,
-                Vec3D(max_point.x(), max_point.y(), min_point.z()),
-                mat_ptr)
-                );
-
-        box_sides->add_primitive_to_list(std::make_shared<XY_Rectangle>(
-                Vec3D(min_point.x(), min_point.y(), max_point.z()),
-                Vec3D(max_point.x(), max_point.y(), max_point.z()),
-                mat_ptr)
-                );
-
-        box_sides->add_primitive_to_list(std::make_shared<YZ_Rectangle>(
-                min_point,
-                Vec3D(min_point.x(), max_point.y(), max_point.z()),
-                mat_ptr)
-        );
-
-        box_sides->add_primitive_to_list(std::make_shared<YZ_Rectangle>(
-                Vec3D(max_point.x(), min_point.y(), min_point.z()),
-                Vec3D(max_point.x(), max_point.y(), max_point.z()),
-                mat_ptr)
-        );
-
-        box_sides->add_primitive_to_list(std::make_shared<XZ_Rectangle>(
-                min_point,
-                Vec3D(max_point.x(), min_point.y(), max_point.z()),
-                mat_ptr)
-        );
-
-        box_sides->add_primitive_to_list(std::make_shared<XZ_Rectangle>(
-                Vec3D(min_point.x(), max_point.y(), min_point.z()),
-                Vec3D(max_point.x(), max_point.y(), max_point.z()),
-                mat_ptr)
-        );
-
+        bounds[0] = min_point;
+        bounds[1] = max_point;
     }
 
+    /// Reference: An Efficient and Robust Ray–Box Intersection Algorithm - https://people.csail.mit.edu/amy/papers/box-jgt.pdf
     bool intersection(const Ray &r, double t_0, double t_1, Intersection_Information &intersection_info) const override {
-        return box_sides->intersection(r, t_0, t_1, intersection_info);
+        // Intersects the box with a single slab test instead of testing its six sides. The entry
+        // face is hit when the ray starts outside the box; the exit face when it starts inside.
+
+        double t_near = -infinity;
+        double t_far = infinity;
+        int near_axis = 0;
+        int far_axis = 0;
+
+        for (int a = 0; a < 3; a++) {
+            double t_enter = (bounds[r.sign[a]][a] - r.ray_origin[a]) * r.inv_direction[a];
+            double t_exit = (bounds[1 - r.sign[a]][a] - r.ray_origin[a]) * r.inv_direction[a];
+
+            if (t_enter > t_near) {
+                t_near = t_enter;
+                near_axis = a;
+            }
+            if (t_exit < t_far) {
+                t_far = t_exit;
+                far_axis = a;
+            }
+        }
+
+        if (t_near > t_far)
+            return false;
+
+        double t;
+        int axis;
+        double outward_sign;                // the outward normal is ±1 along the axis of the face
+
+        if (t_near >= t_0 && t_near <= t_1) {
+            t = t_near;
+            axis = near_axis;
+            outward_sign = r.sign[axis] ? 1.0 : -1.0;           // entering through the face that faces the ray
+        } else if (t_far >= t_0 && t_far <= t_1) {
+            t = t_far;
+            axis = far_axis;
+            outward_sign = r.sign[axis] ? -1.0 : 1.0;           // leaving through the face the ray points at
+        } else
+            return false;
+
+        Vec3D outward_normal(0, 0, 0);
+        outward_normal[axis] = outward_sign;
+
+        intersection_info.t = t;
+        intersection_info.p = r.at(t);
+        intersection_info.set_face_normal(r, outward_normal);
+        intersection_info.mat_ptr = mat_ptr;
+
+        // Texture coordinates span the face along the two other axes
+        int u_axis = (axis + 1) % 3;
+        int v_axis = (axis + 2) % 3;
+        intersection_info.u = (intersection_info.p[u_axis] - min_point[u_axis]) / (max_point[u_axis] - min_point[u_axis]);
+        intersection_info.v = (intersection_info.p[v_axis] - min_point[v_axis]) / (max_point[v_axis] - min_point[v_axis]);
+        intersection_info.uv_per_unit_length = 1.0 / std::sqrt((max_point[u_axis] - min_point[u_axis]) * (max_point[v_axis] - min_point[v_axis]));
+
+        return true;
     }
 
     bool has_bounding_box(double time_0, double time_1, AABB &surrounding_AABB) const override {
@@ -70,8 +85,8 @@ public:
 private:
     point3D min_point;
     point3D max_point;
+    point3D bounds[2];                      // the two corners, indexed by the ray's direction signs
     std::shared_ptr<Material> mat_ptr;
-    std::shared_ptr<Primitives_Group> box_sides;
 };
 
 #endif //CUDA_RAY_TRACER_BOX_H
@@ -0,0 +1,84 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_MOVING_SPHERE_H
+#define CUDA_RAY_TRACER_MOVING_SPHERE_H
+
+#include "Primitive.h"
+
+/// Reference: Ray Tracing: The Next Week - Section 2: Motion Blur
+// A sphere whose center moves linearly from center_0 at time_0 to center_1 at time_1.
+// Rays carry their own time (set by the camera's shutter), so motion blur comes out of
+// averaging many samples.
+class Moving_Sphere : public Primitive {
+public:
+    // Constructor
+    // -----------------------------------------------------------------------
+    Moving_Sphere(point3D center_0, point3D center_1, double time_0, double time_1, double radius, std::shared_ptr<Material> material) :
+            center_0(center_0), center_1(center_1), time_0(time_0), time_1(time_1), radius(radius), sphere_material(material) {}
+
+    // Overloaded Functions
+    // -----------------------------------------------------------------------
+    /// Reference: An Introduction to Ray Tracing - Section 2.1: Intersection of the Sphere
+    bool intersection(const Ray &r, double t_min, double t_max, Intersection_Information &intersection_info) const override {
+        // The algebraic ray/sphere test, against the sphere's position at the ray's time
+
+        point3D current_center = center(r.get_time());
+        Vec3D OC = r.get_ray_origin() - current_center;
+        auto A = r.get_ray_direction().length_squared();
+        auto half_B = dot_product(OC, r.get_ray_direction());
+        auto C = OC.length_squared() - radius*radius;
+
+        auto discriminant = half_B * half_B - A * C;
+        if (discriminant < 0) return false;
+
+        double sqrt_discriminant = sqrt(discriminant);
+
+        double intersection_t = (-half_B - sqrt_discriminant) / A;
+        if (intersection_t <= t_min || t_max <= intersection_t) {
+            intersection_t = (-half_B + sqrt_discriminant) / A;
+            if (intersection_t <= t_min || t_max <= intersection_t)
+                return false;
+        }
+
+        intersection_info.t = intersection_t;
+        intersection_info.p = r.at(intersection_t);
+        Vec3D outward_normal = (intersection_info.p - current_center) / radius;
+        intersection_info.set_face_normal(r, outward_normal);
+        intersection_info.mat_ptr = sphere_material;
+
+        return true;
+    }
+
+    bool has_bounding_box(double time_0, double time_1, AABB &surrounding_AABB) const override {
+        // Bound the sphere over the whole interval [time_0,time_1]. The motion is linear, so the
+        // boxes at the two ends of the interval are enough.
+
+        Vec3D R(radius, radius, radius);
+        AABB box_0(center(time_0) - R, center(time_0) + R);
+        AABB box_1(center(time_1) - R, center(time_1) + R);
+        surrounding_AABB = construct_surrounding_box(box_0, box_1);
+
+        return true;
+    }
+
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    point3D center(double time) const {
+        // Returns the center of the sphere at the given time
+
+        if (time_1 == time_0)
+            return center_0;
+        return center_0 + ((time - time_0) / (time_1 - time_0)) * (center_1 - center_0);
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    point3D center_0, center_1;                         // centers at time_0 and time_1
+    double time_0, time_1;                              // times at which the sphere is at center_0 and center_1
+    double radius;                                      // radius of the sphere
+    std::shared_ptr<Material> sphere_material;          // material of the sphere
+};
+
+#endif //CUDA_RAY_TRACER_MOVING_SPHERE_H
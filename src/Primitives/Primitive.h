@@ -24,6 +24,15 @@ struct Intersection_Information {
     std::shared_ptr<Material> mat_ptr;      // pointer to the material of the primitive
     double u;                               // texture coordinate
     double v;                               // texture coordinate
+    double uv_per_unit_length = 0.0;        // texture-space length per unit of length on the surface; 0 if the primitive has no (u,v),
+                                            // as for triangles: meshes carry no texture coordinates, so they get no footprint
+    double cone_width = 0.0;                // width of the ray cone at p, set by the integrator; 0 without ray cones
+
+    double texture_footprint() const {
+        // The ray's footprint at p in texture space, for filtered texture lookups
+
+        return cone_width * uv_per_unit_length;
+    }
 
     // Function to make the normal always point out against the ray.
     inline void set_face_normal(const Ray& r, const Vec3D& outward_normal) {
@@ -46,6 +55,7 @@ public:
     virtual bool has_bounding_box(double time_0, double time_1, AABB& surrounding_AABB) const = 0;
     virtual double PDF_value(const point3D& o, const Vec3D& v) const { return 0.0; }
     virtual Vec3D random(const Vec3D& o) const { return Vec3D(1,0,0); }
+    virtual double get_area() const { return 0.0; }         // surface area; used to weigh lights by their power
 };
 
 // Supporting Functions for constructing the different BVH classes
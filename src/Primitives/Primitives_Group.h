@@ -77,14 +77,27 @@ public:
         // primitive from the list and then calling its own random()
 
         auto int_size = static_cast<int>(primitives_list.size());
-        return primitives_list[random_int_in_range(0, int_size-1)]->random(o);
+        if (int_size == 1)
+            return primitives_list[0]->random(o);
+
+        int chosen = std::min(static_cast<int>(sample_1D() * int_size), int_size - 1);
+        return primitives_list[chosen]->random(o);
     }
 
     // Helper Functions
     // -------------------------------------------------------------------
-    void add_primitive_to_list(std::shared_ptr<Primitive> o) { primitives_list.push_back(o); }
+    void add_primitive_to_list(std::shared_ptr<Primitive> o) { primitives_list.push_back(std::move(o)); }
 
     void empty_primitives_list() { primitives_list.clear(); }
+
+    const Primitive& unwrapped() const {
+        // A group of one primitive (e.g. the world after build_BVH(), which wraps the BVH's root) is traced
+        // through that primitive directly, saving a virtual call and a copy of the intersection record per ray
+
+        if (primitives_list.size() == 1)
+            return *primitives_list[0];
+        return *this;
+    }
 public:
     // Data Members
     // -----------------------------------------------------------------------
@@ -6,24 +6,31 @@
 #define CUDA_RAY_TRACER_SPHERE_H
 
 #include "Primitive.h"
-class Sphere : public Primitive {
+template <typename Sphere_Kernel = Default_Sphere_Kernel>
+class Basic_Sphere : public Primitive {
 public:
     // Constructor
     // -----------------------------------------------------------------------
-    Sphere(point3D center, double radius, std::shared_ptr<Material> material) :
+    Basic_Sphere(point3D center, double radius, std::shared_ptr<Material> material) :
             center(center), radius(radius), sphere_material(material) {}
 
     // Overloaded Functions
     // -----------------------------------------------------------------------
     bool intersection(const Ray &r, double t_min, double t_max, Intersection_Information &intersection_info) const override  {
-        // Tests if the ray r intersects the sphere between the interval [t_min,t_max]
-        // NOTE: When measuring runtime, don't call this function; instead, paste the intersection code here.
+        // Tests if the ray r intersects the sphere between the interval [t_min,t_max], with the
+        // algorithm Sphere_Kernel (see Intersection_Kernels.h)
 
-        // return ray_sphere_intersection_geometric_solution(r, t_min, t_max, intersection_info);
+        return intersection(r, t_min, t_max, intersection_info, Sphere_Kernel());
+    }
 
+    bool intersection(const Ray &r, double t_min, double t_max, Intersection_Information &intersection_info, Algebraic_Sphere) const {
         return ray_sphere_intersection_algebraic_solution(r, t_min, t_max, intersection_info);
     }
 
+    bool intersection(const Ray &r, double t_min, double t_max, Intersection_Information &intersection_info, Geometric_Sphere) const {
+        return ray_sphere_intersection_geometric_solution(r, t_min, t_max, intersection_info);
+    }
+
     /// Reference: An Introduction to Ray Tracing - Section 2.1: Intersection of the Sphere
     bool ray_sphere_intersection_algebraic_solution(const Ray &r, double t_min, double t_max, Intersection_Information &intersection_info) const {
         // Get the A, B, C of the quadratic equation
@@ -61,6 +68,8 @@ public:
         intersection_info.p = r.at(intersection_t);
         Vec3D outward_normal = (intersection_info.p - center) / radius;
         intersection_info.set_face_normal(r, outward_normal);
+        get_sphere_uv(outward_normal, intersection_info.u, intersection_info.v);
+        intersection_info.uv_per_unit_length = uv_per_unit_length();
         intersection_info.mat_ptr = sphere_material;
 
         return true;
@@ -110,6 +119,7 @@ public:
         Vec3D outward_normal = (intersection_info.p - center) / radius;
         intersection_info.set_face_normal(r, outward_normal);
         get_sphere_uv(outward_normal, intersection_info.u, intersection_info.v);
+        intersection_info.uv_per_unit_length = uv_per_unit_length();
         intersection_info.mat_ptr = sphere_material;
 
         return true;
@@ -147,8 +157,12 @@ public:
 
         Vec3D direction = center - o;
         auto distance_squared = direction.length_squared();
-        std::vector<Vec3D> uvw = build_ONB(direction);
-        return global_to_ONB_local(uvw, importance_sampling_sphere(radius, distance_squared));
+        ONB uvw(direction);
+        return uvw.to_world(importance_sampling_sphere(radius, distance_squared));
+    }
+
+    double get_area() const override {
+        return 4 * M_PI * radius * radius;
     }
 
 public:
@@ -157,8 +171,9 @@ public:
         // biased towards regions that contribute more to the overall result (i.e., those that
         // face the light, rather than the ones that are at the other side)
 
-        double r1 = random_double();
-        double r2 = random_double();
+        Vec2D u = sample_2D();
+        double r1 = u.x();
+        double r2 = u.y();
         double z = 1 + r2*(sqrt(1-radius*radius/distance_squared) - 1);
 
         double phi = 2*M_PI*r1;
@@ -168,6 +183,12 @@ public:
         return Vec3D(x, y, z);
     }
 
+    double uv_per_unit_length() const {
+        // u covers the equator (2πr) and v a meridian (πr); this is the geometric mean of the two scales
+
+        return 1.0 / (M_PI * radius * std::sqrt(2.0));
+    }
+
     static void get_sphere_uv(const point3D& p, double& u, double& v) {
         double theta = acos(-p.y());
         double phi = atan2(-p.z(), p.x()) + M_PI;
@@ -183,4 +204,6 @@ public:
     std::shared_ptr<Material> sphere_material;          // material of the sphere
 };
 
+typedef Basic_Sphere<> Sphere;
+
 #endif //CUDA_RAY_TRACER_SPHERE_H
\ No newline at end of file
@@ -6,27 +6,38 @@
 #define CUDA_RAY_TRACER_TRIANGLE_H
 
 #include "Primitive.h"
+#include "Primitives_Group.h"
+#include "../Mathematics/Matrix4x4.h"
+#include "../Memory_Arena.h"
 static int num_calls_triangle_intersection = 0;
 // A Triangle class that includes the following ray/triangle intersection algorithms:
 //          1. Möller–Trumbore ray-triangle intersection algorithm
 //          2. // TODO: Badouel ray-triangle intersection algorithm
 //          3. Snyder & Barr ray-triangle intersection algorithm
-class Triangle : public Primitive {
+template <typename Triangle_Kernel = Default_Triangle_Kernel>
+class Basic_Triangle : public Primitive {
 public:
     // Constructor
     // -----------------------------------------------------------------------
-    Triangle(const point3D &a, const point3D &b, const point3D &c, std::shared_ptr<Material> triangle_material)
+    Basic_Triangle(const point3D &a, const point3D &b, const point3D &c, std::shared_ptr<Material> triangle_material)
     : a(a), b(b), c(c), triangle_material(triangle_material) {}
 
     // Overloaded Function
     // -------------------------------------------------------------------
     bool intersection(const Ray &r, double t_0, double t_1, Intersection_Information &intersection_info) const override {
-        // NOTE: When measuring runtime, don't call this function; instead, paste the intersection code here.
+        // Uses the algorithm Triangle_Kernel (see Intersection_Kernels.h)
 
-        // return Snyder_Barr_ray_triangle_intersection(r, t_0, t_1, intersection_info);
+        return intersection(r, t_0, t_1, intersection_info, Triangle_Kernel());
+    }
+
+    bool intersection(const Ray &r, double t_0, double t_1, Intersection_Information &intersection_info, Moller_Trumbore_Triangle) const {
         return Moller_Trumbore_ray_triangle_intersection(r, t_0, t_1, intersection_info);
     }
 
+    bool intersection(const Ray &r, double t_0, double t_1, Intersection_Information &intersection_info, Snyder_Barr_Triangle) const {
+        return Snyder_Barr_ray_triangle_intersection(r, t_0, t_1, intersection_info);
+    }
+
     /// Reference: Ray Tracing Complex Models Containing Surface Tessellations
     bool Snyder_Barr_ray_triangle_intersection(const Ray &r, double t_0, double t_1, Intersection_Information &intersection_info) const {
         // Snyder & Barr ray-triangle intersection algorithm
@@ -175,7 +186,7 @@ public:
         if (!this->intersection(Ray(o, v), 0.001, infinity, intersection_info))
             return 0;
 
-        double cost_theta_I = dot_product(-v, intersection_info.normal);
+        double cost_theta_I = dot_product(-unit_vector(v), intersection_info.normal);
         if (cost_theta_I <= 0.0f)
             return 0;
 
@@ -187,8 +198,9 @@ public:
     Vec3D random(const Vec3D &o) const override {
         // Generates a random direction within the triangle based on importance sampling
 
-        double u1 = random_double();
-        double u2 = random_double();
+        Vec2D u = sample_2D();
+        double u1 = u.x();
+        double u2 = u.y();
 
         if (u1 + u2 > 1.0) {
             u1 = 1.0 - u1;
@@ -203,6 +215,10 @@ public:
         return w + a - o;
     }
 
+    double get_area() const override {
+        return area();
+    }
+
 public:
     // Data Members
     // -----------------------------------------------------------------------
@@ -218,6 +234,8 @@ public:
 
 };
 
+typedef Basic_Triangle<> Triangle;
+
 // Functions to facilitate loading Meshes from OBJ Files
 // -----------------------------------------------------------------------
 void load_model(const std::string& file_name,std::vector<point3D>& vertices,
@@ -484,6 +502,60 @@ void load_model(const std::string& file_name,std::vector<point3D>& vertices,
     obj_file.close();
 }
 
+inline void add_mesh_to_world(Primitives_Group& world, const std::vector<Triangle>& triangles) {
+    // Adds the triangles to the world from one Memory_Arena instead of one std::make_shared each: a heap block
+    // per arena block rather than per triangle, and one reference count shared by the whole mesh. The arena is
+    // freed once nothing refers to any of the triangles (e.g. after BVH_Flat copied them).
+
+    std::shared_ptr<Memory_Arena> mesh_arena = std::make_shared<Memory_Arena>();
+    world.primitives_list.reserve(world.primitives_list.size() + triangles.size());
+    for (const Triangle& triangle : triangles)
+        world.add_primitive_to_list(mesh_arena->make_shared<Triangle>(triangle));
+}
+
+inline bool load_OBJ_mesh(const std::string& file_name, const std::shared_ptr<Material>& material,
+                          const Matrix4x4& object_to_world, std::vector<Triangle>& triangles) {
+    // Loads the faces of an OBJ file as triangles, with the vertices transformed by object_to_world.
+    // Unlike the load_model() variants above it accepts "f v/vt/vn" faces, negative (relative) indices
+    // and polygons (split into a fan of triangles). Returns false if the file cannot be read.
+
+    std::ifstream obj_file(file_name);
+    if (!obj_file.is_open()) {
+        std::cerr << "ERROR: UNABLE TO OPEN OBJ FILE " << file_name << std::endl;
+        return false;
+    }
+
+    std::vector<point3D> vertices;
+    std::vector<int> face;
+    std::string line;
+    while (std::getline(obj_file, line)) {
+        std::istringstream iss(line);
+        std::string token;
+        iss >> token;
+
+        if (token == "v") {
+            double x, y, z;
+            iss >> x >> y >> z;
+            vertices.push_back(object_to_world.transform_point(point3D(x, y, z)));
+        } else if (token == "f") {
+            // Only the vertex index of each "v/vt/vn" is used; OBJ indices start from 1, or count back from the last vertex
+            face.clear();
+            while (iss >> token) {
+                int index = std::atoi(token.c_str());
+                index = (index < 0) ? static_cast<int>(vertices.size()) + index : index - 1;
+                if (index < 0 || index >= static_cast<int>(vertices.size())) {
+                    std::cerr << "ERROR: BAD FACE IN OBJ FILE " << file_name << ": " << line << std::endl;
+                    return false;
+                }
+                face.push_back(index);
+            }
+            for (size_t k = 2; k < face.size(); k++)
+                triangles.emplace_back(vertices[face[0]], vertices[face[k - 1]], vertices[face[k]], material);
+        }
+    }
+    return true;
+}
+
 
 
 #endif //CUDA_RAY_TRACER_TRIANGLE_H
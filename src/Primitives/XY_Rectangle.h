@@ -46,6 +46,9 @@ public:
         intersection_info.set_face_normal(r, outward_normal);
         intersection_info.mat_ptr = mat_ptr;
         intersection_info.p = r.at(t);
+        intersection_info.u = (x_comp - min_point.x()) / (max_point.x() - min_point.x());
+        intersection_info.v = (y_comp - min_point.y()) / (max_point.y() - min_point.y());
+        intersection_info.uv_per_unit_length = 1.0 / std::sqrt((max_point.x() - min_point.x()) * (max_point.y() - min_point.y()));
 
         return true;
     }
@@ -76,10 +79,16 @@ public:
     Vec3D random(const Vec3D &o) const override {
         // Generates a random direction within the XY_Rectangle based on importance sampling
 
-        point3D random_point = point3D(random_double(min_point.x(),max_point.x()), random_double(min_point.y(),max_point.y()), z_comp);
+        Vec2D u = sample_2D();
+        point3D random_point = point3D(min_point.x() + u.x() * (max_point.x() - min_point.x()),
+                                       min_point.y() + u.y() * (max_point.y() - min_point.y()), z_comp);
         return random_point - o;
     }
 
+    double get_area() const override {
+        return (max_point.x() - min_point.x()) * (max_point.y() - min_point.y());
+    }
+
 private:
     // Data Members
     // -----------------------------------------------------------------------
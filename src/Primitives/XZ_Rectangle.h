@@ -43,6 +43,9 @@ public:
         intersection_info.set_face_normal(r, outward_normal);
         intersection_info.mat_ptr = mat_ptr;
         intersection_info.p = r.at(t);
+        intersection_info.u = (x_comp - min_point.x()) / (max_point.x() - min_point.x());
+        intersection_info.v = (z_comp - min_point.z()) / (max_point.z() - min_point.z());
+        intersection_info.uv_per_unit_length = 1.0 / std::sqrt((max_point.x() - min_point.x()) * (max_point.z() - min_point.z()));
 
         return true;
     }
@@ -71,14 +74,15 @@ public:
     Vec3D random(const Vec3D &o) const override {
         // Generates a random direction within the XZ_Rectangle based on importance sampling
 
-        point3D random_point = point3D(random_double(min_point.x(), max_point.x()), y_comp,
-                                       random_double(min_point.z(), max_point.z()));
+        Vec2D u = sample_2D();
+        point3D random_point = point3D(min_point.x() + u.x() * (max_point.x() - min_point.x()), y_comp,
+                                       min_point.z() + u.y() * (max_point.z() - min_point.z()));
         return random_point - o;
     }
 
     // Getters
     // -------------------------------------------------------------------------------
-    double get_area() const {
+    double get_area() const override {
         // Calculate the area of the rectangle. Used for directly sampling the light
 
         return area;
@@ -43,6 +43,9 @@ public:
         intersection_info.set_face_normal(r, outward_normal);
         intersection_info.mat_ptr = mat_ptr;
         intersection_info.p = r.at(t);
+        intersection_info.u = (y_comp - min_point.y()) / (max_point.y() - min_point.y());
+        intersection_info.v = (z_comp - min_point.z()) / (max_point.z() - min_point.z());
+        intersection_info.uv_per_unit_length = 1.0 / std::sqrt((max_point.y() - min_point.y()) * (max_point.z() - min_point.z()));
 
         return true;
     }
@@ -73,11 +76,16 @@ public:
     Vec3D random(const Vec3D &o) const override {
         // Generates a random direction within the YZ_Rectangle based on importance sampling
 
-        point3D random_point = point3D(x_comp, random_double(min_point.y(), max_point.y()),
-                                       random_double(min_point.z(), max_point.z()));
+        Vec2D u = sample_2D();
+        point3D random_point = point3D(x_comp, min_point.y() + u.x() * (max_point.y() - min_point.y()),
+                                       min_point.z() + u.y() * (max_point.z() - min_point.z()));
         return random_point - o;
     }
 
+    double get_area() const override {
+        return (max_point.y() - min_point.y()) * (max_point.z() - min_point.z());
+    }
+
 private:
     // Data Members
     // -----------------------------------------------------------------------
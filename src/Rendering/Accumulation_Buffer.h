@@ -0,0 +1,232 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_ACCUMULATION_BUFFER_H
+#define CUDA_RAY_TRACER_ACCUMULATION_BUFFER_H
+
+#include "../Utilities.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// The running sum of the samples of every pixel together with how many samples went into it. Unlike
+// pixel_colors, which only makes sense once every pixel has all its samples, an accumulation buffer can be
+// saved at any moment and picked up again: each pixel's next sample index is first_sample + its sample count.
+// Buffers of the same scene that hold disjoint sample ranges (rendered by different processes, see
+// Tools/merge_buffers.cpp) add up with merge(). A merge whose pixels are left with a gap in their samples
+// (say 0-63 and 128-191) can still be averaged, but not saved: first_sample + count would name the wrong
+// samples to resume from.
+//
+// Binary file layout, in native byte order (not portable across endianness):
+//      char[8]   "CRTACCB2"
+//      int32     width, height, first_sample
+//      int32     length of the label, then the label's characters (the scene it belongs to)
+//      width * height * { double r, g, b (sum of the samples); uint32 samples }, bottom row first
+// -----------------------------------------------------------------------
+class Accumulation_Buffer {
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    Accumulation_Buffer() = default;
+
+    Accumulation_Buffer(int width, int height, const std::string& label, int first_sample = 0) :
+            width(width), height(height), first_sample(first_sample), label(label),
+            sum(width * height, Color(0, 0, 0)), samples(width * height, 0) {}
+
+    // Accumulation
+    // -----------------------------------------------------------------------
+    void add_sample(int i, int j, const Color& c) {
+        int k = j * width + i;
+        sum[k] += c;
+        samples[k]++;
+    }
+
+    void add_samples(int i, int j, const Color& c, uint32_t count) {
+        // Adds count samples whose sum is c, e.g. a pass's samples summed by the thread that rendered them
+
+        int k = j * width + i;
+        sum[k] += c;
+        samples[k] += count;
+    }
+
+    Color average(int i, int j) const {
+        int k = j * width + i;
+        return samples[k] > 0 ? sum[k] / samples[k] : Color(0, 0, 0);
+    }
+
+    Color sample_sum(int i, int j) const {
+        return sum[j * width + i];
+    }
+
+    uint32_t sample_count(int i, int j) const {
+        return samples[j * width + i];
+    }
+
+    uint32_t minimum_sample_count() const {
+        return samples.empty() ? 0 : *std::min_element(samples.begin(), samples.end());
+    }
+
+    uint32_t maximum_sample_count() const {
+        return samples.empty() ? 0 : *std::max_element(samples.begin(), samples.end());
+    }
+
+    bool merge(const Accumulation_Buffer& other) {
+        // Adds the samples of other, which must be of the same scene and hold a different sample range
+
+        if (other.width != width || other.height != height || other.label != label) {
+            std::cerr << "CANNOT MERGE BUFFERS OF DIFFERENT SCENES OR SIZES: " << label << " " << width << "x" << height
+                      << " AND " << other.label << " " << other.width << "x" << other.height << "\n";
+            return false;
+        }
+
+        // Every pixel's samples stay one run from first_sample if, wherever the later buffer has samples, the
+        // earlier one's reach up to its first sample
+        const Accumulation_Buffer& earlier = first_sample <= other.first_sample ? *this : other;
+        const Accumulation_Buffer& later = first_sample <= other.first_sample ? other : *this;
+        bool runs_join = contiguous && other.contiguous;
+        for (size_t k = 0; k < sum.size() && runs_join; k++)
+            runs_join = later.samples[k] == 0 || earlier.first_sample + static_cast<int64_t>(earlier.samples[k]) == later.first_sample;
+
+        for (size_t k = 0; k < sum.size(); k++) {
+            sum[k] += other.sum[k];
+            samples[k] += other.samples[k];
+        }
+        first_sample = std::min(first_sample, other.first_sample);
+        contiguous = runs_join;
+        return true;
+    }
+
+    // Files
+    // -----------------------------------------------------------------------
+    bool save(const std::string& file_name) const {
+        // Writes to <file_name>.tmp and renames it, so a crash while saving leaves the previous file intact
+
+        if (!contiguous) {
+            std::cerr << "CANNOT SAVE A MERGE WITH GAPS BETWEEN ITS SAMPLE RANGES AS A RESUMABLE BUFFER: " << file_name << "\n";
+            return false;
+        }
+
+        std::string temporary = file_name + ".tmp";
+        std::ofstream out(temporary, std::ios_base::out | std::ios_base::binary);
+        if (!out)
+            return false;
+
+        int32_t header[3] = {width, height, first_sample};
+        int32_t label_length = static_cast<int32_t>(label.size());
+        out.write(magic(), 8);
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(&label_length), sizeof(label_length));
+        out.write(label.data(), label_length);
+
+        for (size_t k = 0; k < sum.size(); k++) {
+            double rgb[3] = {sum[k].x(), sum[k].y(), sum[k].z()};
+            out.write(reinterpret_cast<const char*>(rgb), sizeof(rgb));
+            out.write(reinterpret_cast<const char*>(&samples[k]), sizeof(uint32_t));
+        }
+
+        out.close();
+        if (!out)
+            return false;
+        return std::rename(temporary.c_str(), file_name.c_str()) == 0;
+    }
+
+    bool load(const std::string& file_name) {
+        std::ifstream in(file_name, std::ios_base::in | std::ios_base::binary);
+        if (!in)
+            return false;
+
+        char file_magic[8];
+        int32_t header[3];
+        int32_t label_length = 0;
+        in.read(file_magic, 8);
+        in.read(reinterpret_cast<char*>(header), sizeof(header));
+        in.read(reinterpret_cast<char*>(&label_length), sizeof(label_length));
+        if (!in || std::memcmp(file_magic, magic(), 8) != 0 || header[0] <= 0 || header[1] <= 0 || header[2] < 0 || label_length < 0) {
+            std::cerr << "NOT AN ACCUMULATION BUFFER: " << file_name << "\n";
+            return false;
+        }
+
+        // Check the sizes against the file before allocating anything: a corrupt header could ask for more
+        // than the file holds, or a width * height that overflows an int
+        std::streamoff header_end = in.tellg();
+        in.seekg(0, std::ios_base::end);
+        int64_t remaining = static_cast<int64_t>(in.tellg() - header_end);
+        in.seekg(header_end);
+        int64_t pixels = static_cast<int64_t>(header[0]) * header[1];
+        const int64_t pixel_bytes = 3 * sizeof(double) + sizeof(uint32_t);
+        if (label_length > remaining || pixels > std::numeric_limits<int>::max() ||
+            pixels * pixel_bytes > remaining - label_length) {
+            std::cerr << "TRUNCATED ACCUMULATION BUFFER: " << file_name << "\n";
+            return false;
+        }
+
+        std::string file_label(label_length, ' ');
+        in.read(&file_label[0], label_length);
+
+        int n = static_cast<int>(pixels);
+        std::vector<Color> file_sum(n);
+        std::vector<uint32_t> file_samples(n);
+        for (int k = 0; k < n; k++) {
+            double rgb[3];
+            in.read(reinterpret_cast<char*>(rgb), sizeof(rgb));
+            in.read(reinterpret_cast<char*>(&file_samples[k]), sizeof(uint32_t));
+            file_sum[k] = Color(rgb[0], rgb[1], rgb[2]);
+        }
+        if (!in) {
+            std::cerr << "TRUNCATED ACCUMULATION BUFFER: " << file_name << "\n";
+            return false;
+        }
+
+        width = header[0];
+        height = header[1];
+        first_sample = header[2];
+        label = file_label;
+        sum.swap(file_sum);
+        samples.swap(file_samples);
+        contiguous = true;
+        return true;
+    }
+
+    void write_PPM(const std::string& file_name) const {
+        // The average of each pixel, with the renderers' NaN removal and 2-gamma
+
+        std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
+        ofs << "P3\n" << width << " " << height << "\n255\n";
+        for (int j = height - 1; j >= 0; --j) {
+            for (int i = 0; i < width; ++i) {
+                Color c = average(i, j);
+                double r_comp = std::isnan(c.x()) ? 0.0 : gamma_2_correction(c.x());
+                double g_comp = std::isnan(c.y()) ? 0.0 : gamma_2_correction(c.y());
+                double b_comp = std::isnan(c.z()) ? 0.0 : gamma_2_correction(c.z());
+
+                ofs << static_cast<int>(255 * clamp(r_comp, 0.0, 0.999)) << ' '
+                    << static_cast<int>(255 * clamp(g_comp, 0.0, 0.999)) << ' '
+                    << static_cast<int>(255 * clamp(b_comp, 0.0, 0.999)) << '\n';
+            }
+        }
+    }
+
+    // Getters
+    // -----------------------------------------------------------------------
+    int get_width() const { return width; }
+    int get_height() const { return height; }
+    int get_first_sample() const { return first_sample; }
+    bool has_contiguous_samples() const { return contiguous; }
+    const std::string& get_label() const { return label; }
+
+private:
+    static const char* magic() { return "CRTACCB2"; }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    int width = 0;
+    int height = 0;
+    int first_sample = 0;               // sample index of the first sample of every pixel
+    std::string label;                  // which scene the samples belong to
+    std::vector<Color> sum;             // sum of the samples of each pixel, bottom row first
+    std::vector<uint32_t> samples;      // number of samples in each sum
+    bool contiguous = true;             // every pixel's samples are first_sample, first_sample + 1, ...
+};
+
+#endif //CUDA_RAY_TRACER_ACCUMULATION_BUFFER_H
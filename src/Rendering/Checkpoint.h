@@ -0,0 +1,93 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_CHECKPOINT_H
+#define CUDA_RAY_TRACER_CHECKPOINT_H
+
+#include "../Utilities.h"
+#include "Accumulation_Buffer.h"
+#include <csignal>
+
+// Checkpoint and resume for long renders. The checkpointed renderer traces a few samples per pixel at a
+// time into an Accumulation_Buffer and saves it to a file every `interval` seconds. Started again with the
+// same scene, it loads the file and carries on from each pixel's sample count, so the sample indices (and
+// with them the sampler's sequence) continue instead of starting over. Raising samples_per_pixel and
+// resuming a finished render adds samples to it.
+//
+// While it renders, SIGINT and SIGTERM (Ctrl-C, or a preemptible node being reclaimed) stop the render
+// loop at the next 16x16 tile; the renderer then saves the checkpoint and a preview image and exits.
+// -----------------------------------------------------------------------
+struct Checkpoint_Settings {
+    bool enabled = false;                   // save/resume the accumulation buffer and catch SIGINT/SIGTERM
+    std::string file;                       // empty: <image>.checkpoint
+    double interval = 300.0;                // seconds between checkpoints
+    int samples_per_pass = 4;               // samples added to every pixel between two looks at the clock
+    bool write_image = true;                // false: the accumulation buffer is the only output (sample-partitioned renders)
+};
+
+inline std::string checkpoint_file_name(const Checkpoint_Settings& settings, const std::string& image_name) {
+    return settings.file.empty() ? image_name + ".checkpoint" : settings.file;
+}
+
+// Interrupt Handling
+// -----------------------------------------------------------------------
+static volatile std::sig_atomic_t render_interrupt_signal = 0;      // the signal that interrupted the render, 0 if none
+
+inline void request_render_interrupt(int signal_number) {
+    render_interrupt_signal = signal_number;
+}
+
+class Interrupt_Handlers {
+    // Catches SIGINT and SIGTERM for as long as it lives, then puts the previous handlers back
+
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    Interrupt_Handlers() {
+        render_interrupt_signal = 0;
+        previous_SIGINT = std::signal(SIGINT, request_render_interrupt);
+        previous_SIGTERM = std::signal(SIGTERM, request_render_interrupt);
+    }
+
+    ~Interrupt_Handlers() {
+        std::signal(SIGINT, previous_SIGINT);
+        std::signal(SIGTERM, previous_SIGTERM);
+    }
+
+    Interrupt_Handlers(const Interrupt_Handlers&) = delete;
+    Interrupt_Handlers& operator=(const Interrupt_Handlers&) = delete;
+
+private:
+    // Data Members
+    // -----------------------------------------------------------------------
+    void (*previous_SIGINT)(int);
+    void (*previous_SIGTERM)(int);
+};
+
+// Checkpoint Files
+// -----------------------------------------------------------------------
+inline bool resume_from_checkpoint(const std::string& file_name, Accumulation_Buffer& buffer) {
+    // Replaces buffer with the checkpoint if there is one. A checkpoint of another scene or image size is an error.
+
+    Accumulation_Buffer saved;
+    if (!saved.load(file_name))
+        return false;
+
+    if (saved.get_width() != buffer.get_width() || saved.get_height() != buffer.get_height() ||
+        saved.get_label() != buffer.get_label() || saved.get_first_sample() != buffer.get_first_sample()) {
+        std::cerr << "CHECKPOINT " << file_name << " (" << saved.get_label() << ", " << saved.get_width() << "x"
+                  << saved.get_height() << ", first sample " << saved.get_first_sample() << ") DOES NOT MATCH THE SCENE!\n";
+        exit(0);
+    }
+
+    buffer = saved;
+    return true;
+}
+
+inline void save_checkpoint(const std::string& file_name, const Accumulation_Buffer& buffer) {
+    if (!buffer.save(file_name))
+        std::cerr << "COULD NOT WRITE CHECKPOINT " << file_name << "\n";
+}
+
+#endif //CUDA_RAY_TRACER_CHECKPOINT_H
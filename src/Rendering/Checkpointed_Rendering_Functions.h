@@ -0,0 +1,197 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_CHECKPOINTED_RENDERING_FUNCTIONS_H
+#define CUDA_RAY_TRACER_CHECKPOINTED_RENDERING_FUNCTIONS_H
+
+#include "../Utilities.h"
+#include "../Cameras/Camera.h"
+#include "../Shading.h"
+#include "../Scenes.h"
+#include "Accumulation_Buffer.h"
+#include "Checkpoint.h"
+#include "Tile_Rendering_Functions.h"
+
+// Function that renders with the radiance_mixture(...) function in passes of a few samples per pixel, so
+// that the render can be checkpointed, killed and resumed (see Rendering/Checkpoint.h). With
+// scene_info.checkpoint.enabled false it renders the same estimator as parallel_loop_radiance_mixture_renderer().
+//
+// It renders the sample indices [first_sample, first_sample + samples_per_pixel) of every pixel. Several
+// processes given disjoint ranges of the same frame each save their accumulation buffer (the checkpoint
+// file), and Tools/merge_buffers.cpp adds them up into the image, at any time.
+// -----------------------------------------------------------------------
+void parallel_checkpointed_radiance_mixture_renderer(Scene_Information& scene_info) {
+    /* Parallelization Strategy: each pass is a parallel loop over 16x16 tiles, so that threads write to
+       different parts of the accumulation buffer instead of neighbouring pixels of the same rows */
+
+    // Get scene information
+    // -------------------------------------------------------------------------------
+
+    // Image
+    // -------------------------------------------------------------------------------
+    const auto aspect_ratio = scene_info.aspect_ratio;
+    const int image_width = scene_info.image_width;
+    const int image_height = static_cast<int>(image_width / aspect_ratio);
+    int max_depth = scene_info.max_depth;
+
+    // World
+    // -------------------------------------------------------------------------------
+    const Primitive& world = scene_info.world.unwrapped();
+    Primitives_Group lights = scene_info.lights;
+    int samples_per_pixel = scene_info.samples_per_pixel;
+    int first_sample = scene_info.first_sample;
+    int num_threads = scene_info.number_of_threads_used;
+    std::shared_ptr<Sampler> sampler = scene_info.sampler;
+
+    // Camera
+    // -------------------------------------------------------------------------------
+    Camera cam = scene_info.camera;
+    if (scene_info.ray_cones)
+        cam.enable_ray_cones(image_height);
+
+    // Checkpoint
+    // -------------------------------------------------------------------------------
+    const Checkpoint_Settings& checkpoint = scene_info.checkpoint;
+    const std::string checkpoint_file = checkpoint_file_name(checkpoint, scene_info.output_image_name);
+    const int samples_per_pass = std::max(1, checkpoint.samples_per_pass);
+
+    Accumulation_Buffer buffer(image_width, image_height, scene_info.output_image_name, first_sample);
+    bool resumed = checkpoint.enabled && resume_from_checkpoint(checkpoint_file, buffer);
+    if (resumed)
+        std::cout << "Resuming from " << checkpoint_file << " at " << buffer.minimum_sample_count()
+                  << " samples-per-pixel" << std::endl;
+
+    // The samplers get distinct sample indices from first_sample and each pixel's count. rand(), which a few
+    // PDFs still call directly, is reseeded so that another process or a resumed run does not replay its stream.
+    if (resumed || first_sample != 0)
+        std::srand(static_cast<unsigned>(hash_ints(first_sample, buffer.minimum_sample_count(),
+                                                   static_cast<uint64_t>(omp_get_wtime() * 1e6))));
+
+    std::cout << "Image height = " << image_height << std::endl;
+    std::cout << "Image Width = " << image_width << std::endl;
+    std::cout << "Depth = " << max_depth << std::endl;
+    std::cout << "Samples-per-pixel = " << samples_per_pixel << std::endl;
+
+    // Render Loop
+    // -----------------------------------------------------------------------
+    const std::vector<Image_Tile> tiles = split_into_tiles(image_width, image_height, 16);
+    const int number_of_tiles = static_cast<int>(tiles.size());
+    double render_start = omp_get_wtime();
+    double last_checkpoint = render_start;
+    int interrupted_by = 0;
+    {
+        std::unique_ptr<Interrupt_Handlers> handlers;
+        if (checkpoint.enabled)
+            handlers.reset(new Interrupt_Handlers());
+
+        while (buffer.minimum_sample_count() < static_cast<uint32_t>(samples_per_pixel)) {
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+            for (int t = 0; t < number_of_tiles; ++t) {
+                if (render_interrupt_signal)
+                    continue;
+
+                const Image_Tile& tile = tiles[t];
+                for (int j = tile.y1 - 1; j >= tile.y0; --j) {
+                    for (int i = tile.x0; i < tile.x1; ++i) {
+                        // Each pixel continues from its own count: an interrupted pass leaves some tiles ahead
+                        int done = static_cast<int>(buffer.sample_count(i, j));
+                        int end = std::min(done + samples_per_pass, samples_per_pixel);
+
+                        // The pass's samples are summed here and added to the buffer once per pixel
+                        Color pixel_color(0.0, 0.0, 0.0);
+                        for (int s = first_sample + done; s < first_sample + end; ++s) {
+                            start_pixel_sample(sampler, i, j, s);
+                            Vec2D pixel_offset = sample_2D();
+                            auto u = (i + pixel_offset.x()) / (image_width - 1);
+                            auto v = (j + pixel_offset.y()) / (image_height - 1);
+
+                            Ray r = cam.get_ray(u, v);
+                            pixel_color += radiance_mixture(r, world, lights, max_depth);
+                        }
+                        if (end > done)
+                            buffer.add_samples(i, j, pixel_color, static_cast<uint32_t>(end - done));
+                    }
+                }
+            }
+
+            interrupted_by = render_interrupt_signal;
+            if (interrupted_by)
+                break;
+
+            if (checkpoint.enabled && omp_get_wtime() - last_checkpoint >= checkpoint.interval) {
+                save_checkpoint(checkpoint_file, buffer);
+                last_checkpoint = omp_get_wtime();
+                std::cout << "Checkpoint at " << buffer.minimum_sample_count() << " samples-per-pixel" << std::endl;
+            }
+        }
+    }
+    scene_info.render_time = omp_get_wtime() - render_start;
+    scene_info.rays_traced = number_of_rays_traced();
+
+    if (interrupted_by) {
+        save_checkpoint(checkpoint_file, buffer);
+        buffer.write_PPM(scene_info.output_image_name + "_preview.ppm");
+        std::cerr << "\nRENDER INTERRUPTED BY SIGNAL " << interrupted_by << " AT " << buffer.minimum_sample_count()
+                  << " SAMPLES-PER-PIXEL; SAVED " << checkpoint_file << " AND " << scene_info.output_image_name
+                  << "_preview.ppm\n";
+        exit(128 + interrupted_by);
+    }
+
+    // The finished buffer is saved too, so that resuming with more samples-per-pixel adds to it
+    if (checkpoint.enabled)
+        save_checkpoint(checkpoint_file, buffer);
+
+    std::cerr << "\nDone.\n";
+
+    if (!checkpoint.write_image)
+        return;
+
+    std::vector<std::vector<Color>> pixel_colors(image_height, std::vector<Color>(image_width, Color(0, 0, 0)));
+    for (int j = 0; j < image_height; ++j)
+        for (int i = 0; i < image_width; ++i)
+            pixel_colors[j][i] = buffer.average(i, j) * samples_per_pixel;
+
+    post_process_framebuffer(scene_info.denoiser, cam, world, sampler, samples_per_pixel, num_threads,
+                             scene_info.output_image_name, pixel_colors);
+
+    // Fill the image file with the correct order of pixels
+    // Reference: How to write to a PPM file? https://www.rosettacode.org/wiki/Bitmap/Write_a_PPM_file#C++
+    const std::string& file_name = scene_info.output_image_name + ".ppm";
+    std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
+    ofs << "P3\n" << image_width << " " << image_height << "\n255\n";
+    for (int j = image_height - 1; j >= 0; --j) {
+        for (int i = 0; i < image_width; ++i) {
+            Color pixel_color = pixel_colors[j][i];
+
+            // Average the colors from all samples
+            pixel_color /= samples_per_pixel;
+
+            // Apply 2-gamma
+            double r_comp = pixel_color.x();
+            double g_comp = pixel_color.y();
+            double b_comp = pixel_color.z();
+
+            // Get rid of acne: white or black dots
+            if (std::isnan(r_comp))
+                r_comp = 0.0;
+            if (std::isnan(g_comp))
+                g_comp = 0.0;
+            if (std::isnan(b_comp))
+                b_comp = 0.0;
+
+            r_comp = gamma_2_correction(r_comp);
+            g_comp = gamma_2_correction(g_comp);
+            b_comp = gamma_2_correction(b_comp);
+
+            // Write the averaged color to the PPM file
+            ofs << static_cast<int>(255 * clamp(r_comp, 0.0, 0.999)) << ' '
+                << static_cast<int>(255 * clamp(g_comp, 0.0, 0.999)) << ' '
+                << static_cast<int>(255 * clamp(b_comp, 0.0, 0.999)) << '\n';
+        }
+    }
+
+    std::cout << "Name of file rendered: " << scene_info.output_image_name << std::endl;
+}
+
+#endif //CUDA_RAY_TRACER_CHECKPOINTED_RENDERING_FUNCTIONS_H
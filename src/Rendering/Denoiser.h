@@ -0,0 +1,298 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_DENOISER_H
+#define CUDA_RAY_TRACER_DENOISER_H
+
+#include "../Utilities.h"
+#include "../Cameras/Camera.h"
+#include "../Primitives/Primitive.h"
+#include "../Materials/Material_Table.h"
+#include "../Samplers/Sampler.h"
+#include "Render_Statistics.h"
+
+/// Reference: Edge-Avoiding À-Trous Wavelet Transform for fast Global Illumination Filtering - https://doi.org/10.2312/EGGH/HPG10/067-075
+// A post stage on the framebuffer that lets a scene be rendered at 64-256 samples-per-pixel instead of
+// thousands. It has two parts:
+//      - AOVs (arbitrary output variables): the albedo, shading normal and distance of the first hit of
+//        each pixel, averaged over a few camera rays. They are noise-free, so they tell the filter where
+//        the geometric and texture edges are.
+//      - An à-trous wavelet filter: a 5x5 B3-spline kernel applied `iterations` times with holes of
+//        1, 2, 4, ... pixels between its taps, so it covers a (4 * 2^iterations + 1)^2 footprint with 25 taps
+//        per pass. Each tap is weighted down by how much its color, normal, depth and albedo differ from the
+//        center pixel's, which keeps the edges sharp (a joint bilateral filter).
+// The color is divided by the albedo before filtering and multiplied back afterwards, so textures are not
+// blurred with the lighting.
+// -----------------------------------------------------------------------
+struct Denoiser_Settings {
+    bool denoise = false;                   // filter the framebuffer before it is written
+    bool write_AOVs = false;                // also write <image>_albedo.ppm, <image>_normal.ppm and <image>_depth.ppm
+    int iterations = 5;                     // à-trous passes; the last one has taps 2^(iterations-1) pixels apart
+    int AOV_samples_per_pixel = 4;          // camera rays averaged into each pixel's AOVs
+    double sigma_color = 1.0;               // halved on every pass, as in the paper
+    double sigma_normal = 0.3;
+    double sigma_depth = 0.1;               // relative to the center pixel's depth
+    double sigma_albedo = 0.1;
+};
+
+struct AOV_Buffers {
+    // First-hit auxiliary buffers; pixel (i,j) is element j * width + i, with j = 0 the bottom row as in pixel_colors
+
+    int width = 0;
+    int height = 0;
+    std::vector<Color> albedo;
+    std::vector<Vec3D> normal;              // facing the camera; (0,0,0) for a miss
+    std::vector<double> depth;              // distance along the camera ray; 0 for a miss
+
+    void resize(int w, int h) {
+        width = w;
+        height = h;
+        albedo.assign(w * h, Color(0, 0, 0));
+        normal.assign(w * h, Vec3D(0, 0, 0));
+        depth.assign(w * h, 0.0);
+    }
+};
+
+inline Color first_hit_albedo(const Ray& r, const Intersection_Information& rec) {
+    // What the surface does to light: the scattering color, or the (normalized) emission of a light
+
+    Material_Sample s = sample_material(*rec.mat_ptr, r, rec);
+    if (s.scattered)
+        return s.color;
+
+    Color emission = material_emission(*rec.mat_ptr, rec);
+    double largest = std::max(emission.x(), std::max(emission.y(), emission.z()));
+    return largest > 1.0 ? emission / largest : emission;
+}
+
+inline AOV_Buffers render_AOVs(const Camera& cam, const Primitive& world, const std::shared_ptr<Sampler>& sampler,
+                               int image_width, int image_height, int samples, int num_threads) {
+    // Uses the same pixel samples as the first `samples` samples of the color pass, so the AOVs line up with it
+
+    AOV_Buffers aov;
+    aov.resize(image_width, image_height);
+
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+    for (int j = 0; j < image_height; j++) {
+        for (int i = 0; i < image_width; i++) {
+            Color albedo(0, 0, 0);
+            Vec3D normal(0, 0, 0);
+            double depth = 0.0;
+            int hits = 0;
+
+            for (int s = 0; s < samples; s++) {
+                start_pixel_sample(sampler, i, j, s);
+                Vec2D pixel_offset = sample_2D();
+                auto u = (i + pixel_offset.x()) / (image_width - 1);
+                auto v = (j + pixel_offset.y()) / (image_height - 1);
+                Ray r = cam.get_ray(u, v);
+
+                Intersection_Information rec;
+                count_ray();
+                if (!world.intersection(r, 0.001, infinity, rec))
+                    continue;
+
+                rec.cone_width = r.cone_width_at(rec.t);
+                albedo += first_hit_albedo(r, rec);
+                normal += rec.normal;
+                depth += rec.t * r.get_ray_direction().length();
+                hits++;
+            }
+
+            // A pixel is a miss only if all its samples missed
+            if (hits > 0) {
+                int k = j * image_width + i;
+                aov.albedo[k] = albedo / hits;
+                aov.normal[k] = normal.length() > 0.0 ? unit_vector(normal) : Vec3D(0, 0, 0);
+                aov.depth[k] = depth / hits;
+            }
+        }
+    }
+    return aov;
+}
+
+inline void write_PPM(const std::string& file_name, const std::vector<Color>& image, int width, int height) {
+    // image holds display values in [0,1], bottom row first
+
+    std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
+    ofs << "P3\n" << width << " " << height << "\n255\n";
+    for (int j = height - 1; j >= 0; --j) {
+        for (int i = 0; i < width; ++i) {
+            const Color& c = image[j * width + i];
+            ofs << static_cast<int>(255 * clamp(c.x(), 0.0, 0.999)) << ' '
+                << static_cast<int>(255 * clamp(c.y(), 0.0, 0.999)) << ' '
+                << static_cast<int>(255 * clamp(c.z(), 0.0, 0.999)) << '\n';
+        }
+    }
+}
+
+inline void write_AOVs(const AOV_Buffers& aov, const std::string& image_name) {
+    // Albedo with the same 2-gamma as the renders, normals mapped from [-1,1] to [0,1], depth scaled by the farthest hit
+
+    int n = aov.width * aov.height;
+    double farthest = 0.0;
+    for (int k = 0; k < n; k++)
+        farthest = std::max(farthest, aov.depth[k]);
+
+    std::vector<Color> albedo(n), normal(n), depth(n);
+    for (int k = 0; k < n; k++) {
+        const Color& a = aov.albedo[k];
+        albedo[k] = Color(gamma_2_correction(a.x()), gamma_2_correction(a.y()), gamma_2_correction(a.z()));
+        normal[k] = aov.depth[k] > 0.0 ? 0.5 * (aov.normal[k] + Vec3D(1, 1, 1)) : Color(0, 0, 0);
+        double d = farthest > 0.0 ? aov.depth[k] / farthest : 0.0;
+        depth[k] = Color(d, d, d);
+    }
+
+    write_PPM(image_name + "_albedo.ppm", albedo, aov.width, aov.height);
+    write_PPM(image_name + "_normal.ppm", normal, aov.width, aov.height);
+    write_PPM(image_name + "_depth.ppm", depth, aov.width, aov.height);
+}
+
+class A_Trous_Denoiser {
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    explicit A_Trous_Denoiser(const Denoiser_Settings& settings, int num_threads = 1) :
+            settings(settings), num_threads(num_threads) {}
+
+    // Filtering
+    // -----------------------------------------------------------------------
+    void denoise(std::vector<Color>& image, const AOV_Buffers& aov) const {
+        // Filters image (linear radiance, laid out like aov) in place
+
+        int n = aov.width * aov.height;
+
+        // Demodulate: filter the lighting, not the texture
+        std::vector<Color> albedo(n);
+        std::vector<Color> current(n);
+        for (int k = 0; k < n; k++) {
+            albedo[k] = demodulation_albedo(aov.albedo[k]);
+            current[k] = Color(image[k].x() / albedo[k].x(), image[k].y() / albedo[k].y(), image[k].z() / albedo[k].z());
+        }
+
+        std::vector<Color> next(n);
+        for (int iteration = 0; iteration < settings.iterations; iteration++) {
+            a_trous_pass(current, next, aov, 1 << iteration, settings.sigma_color / (1 << iteration));
+            current.swap(next);
+        }
+
+        for (int k = 0; k < n; k++)
+            image[k] = current[k] * albedo[k];
+    }
+
+private:
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    static Color demodulation_albedo(const Color& albedo) {
+        // Channels that reflect (almost) nothing are left as they are instead of being divided by ~0
+
+        const double smallest = 0.01;
+        return Color(albedo.x() < smallest ? 1.0 : albedo.x(),
+                     albedo.y() < smallest ? 1.0 : albedo.y(),
+                     albedo.z() < smallest ? 1.0 : albedo.z());
+    }
+
+    void a_trous_pass(const std::vector<Color>& input, std::vector<Color>& output, const AOV_Buffers& aov, int step, double sigma_color) const {
+        static const double h[5] = {1.0 / 16, 1.0 / 4, 3.0 / 8, 1.0 / 4, 1.0 / 16};     // B3 spline
+
+        const int width = aov.width;
+        const int height = aov.height;
+        const double inverse_color = 1.0 / (sigma_color * sigma_color);
+        const double inverse_normal = 1.0 / (settings.sigma_normal * settings.sigma_normal);
+        const double inverse_albedo = 1.0 / (settings.sigma_albedo * settings.sigma_albedo);
+
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+        for (int j = 0; j < height; j++) {
+            for (int i = 0; i < width; i++) {
+                int p = j * width + i;
+                const Color& color_p = input[p];
+                const Vec3D& normal_p = aov.normal[p];
+                const Color& albedo_p = aov.albedo[p];
+                double depth_p = aov.depth[p];
+
+                Color sum(0, 0, 0);
+                double weight_sum = 0.0;
+                for (int b = -2; b <= 2; b++) {
+                    int y = j + b * step;
+                    if (y < 0 || y >= height)
+                        continue;
+                    for (int a = -2; a <= 2; a++) {
+                        int x = i + a * step;
+                        if (x < 0 || x >= width)
+                            continue;
+
+                        int q = y * width + x;
+                        double depth_q = aov.depth[q];
+                        if ((depth_p > 0.0) != (depth_q > 0.0))
+                            continue;           // a hit and a miss never mix
+
+                        double depth_difference = 0.0;
+                        if (depth_p > 0.0)
+                            depth_difference = std::fabs(depth_p - depth_q) / (settings.sigma_depth * depth_p);
+
+                        double exponent = (color_p - input[q]).length_squared() * inverse_color +
+                                          (normal_p - aov.normal[q]).length_squared() * inverse_normal +
+                                          (albedo_p - aov.albedo[q]).length_squared() * inverse_albedo +
+                                          depth_difference * depth_difference;
+                        double w = h[a + 2] * h[b + 2] * std::exp(-exponent);
+
+                        sum += w * input[q];
+                        weight_sum += w;
+                    }
+                }
+
+                // The center tap always has weight h[2]^2 > 0
+                output[p] = sum / weight_sum;
+            }
+        }
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    Denoiser_Settings settings;
+    int num_threads;
+};
+
+inline void post_process_framebuffer(const Denoiser_Settings& settings, const Camera& cam, const Primitive& world,
+                                     const std::shared_ptr<Sampler>& sampler, int samples_per_pixel, int num_threads,
+                                     const std::string& image_name, std::vector<std::vector<Color>>& pixel_colors) {
+    // Called by the renderers between the render loop and writing the image. pixel_colors[j][i] holds the
+    // sum of the samples of pixel (i,j) and still does when this returns, so the renderer's own averaging,
+    // NaN removal and gamma correction apply to the filtered image as well.
+
+    if (!settings.denoise && !settings.write_AOVs)
+        return;
+
+    const int image_height = static_cast<int>(pixel_colors.size());
+    const int image_width = image_height > 0 ? static_cast<int>(pixel_colors[0].size()) : 0;
+    double start = omp_get_wtime();
+
+    int AOV_samples = std::max(1, std::min(settings.AOV_samples_per_pixel, samples_per_pixel));
+    AOV_Buffers aov = render_AOVs(cam, world, sampler, image_width, image_height, AOV_samples, num_threads);
+
+    if (settings.write_AOVs)
+        write_AOVs(aov, image_name);
+
+    if (settings.denoise) {
+        std::vector<Color> image(image_width * image_height);
+        for (int j = 0; j < image_height; j++) {
+            for (int i = 0; i < image_width; i++) {
+                Color c = pixel_colors[j][i] / samples_per_pixel;
+                image[j * image_width + i] = Color(std::isnan(c.x()) ? 0.0 : c.x(),
+                                                   std::isnan(c.y()) ? 0.0 : c.y(),
+                                                   std::isnan(c.z()) ? 0.0 : c.z());
+            }
+        }
+
+        A_Trous_Denoiser(settings, num_threads).denoise(image, aov);
+
+        for (int j = 0; j < image_height; j++)
+            for (int i = 0; i < image_width; i++)
+                pixel_colors[j][i] = image[j * image_width + i] * samples_per_pixel;
+    }
+
+    std::cout << "Denoising time = " << omp_get_wtime() - start << " seconds" << std::endl;
+}
+
+#endif //CUDA_RAY_TRACER_DENOISER_H
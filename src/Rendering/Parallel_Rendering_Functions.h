@@ -10,6 +10,7 @@
 #include "../Cameras/Orthographic_Camera.h"
 #include "../Shading.h"
 #include "../Scenes.h"
+#include "Tiled_Framebuffer.h"
 
 // Function that renders with the radiance(...) function
 // -----------------------------------------------------------------------
@@ -22,7 +23,8 @@ void parallel_loop_radiance_renderer(Scene_Information& scene_info) {
     // have a different camera/image/render settings, and including all possible choices will make this
     // function long.
 
-    /* Parallelization Strategy: Uses the collapse(2) clause to parallelize the render loop */
+    /* Parallelization Strategy: Parallelizes the render loop over the rows, each written to its own cache
+       lines of a Tiled_Framebuffer */
 
     // Get scene information
     // -------------------------------------------------------------------------------
@@ -36,9 +38,11 @@ void parallel_loop_radiance_renderer(Scene_Information& scene_info) {
 
     // World
     // -------------------------------------------------------------------------------
-    Primitives_Group world = scene_info.world;
+    const Primitive& world = scene_info.world.unwrapped();
     Primitives_Group lights = scene_info.lights;
     int samples_per_pixel = scene_info.samples_per_pixel;
+    int num_threads = scene_info.number_of_threads_used;
+    std::shared_ptr<Sampler> sampler = scene_info.sampler;
 
     // Camera
     // -------------------------------------------------------------------------------
@@ -47,6 +51,8 @@ void parallel_loop_radiance_renderer(Scene_Information& scene_info) {
     Vec3D vup = scene_info.vup;
     double vfov  = scene_info.vfov;
     Camera cam = scene_info.camera;
+    if (scene_info.ray_cones)
+        cam.enable_ray_cones(image_height);
 
     const std::string& file_name = scene_info.output_image_name + ".ppm";
     std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
@@ -60,30 +66,30 @@ void parallel_loop_radiance_renderer(Scene_Information& scene_info) {
     // -----------------------------------------------------------------------
     // Reference: How to write to a PPM file? https://www.rosettacode.org/wiki/Bitmap/Write_a_PPM_file#C++
     ofs << "P3\n" << image_width << " " << image_height << "\n255\n";
+    // Row t of the framebuffer is image row j = image_height - 1 - t
+    Tiled_Framebuffer framebuffer(split_into_rows(image_width, image_height));
+    auto integrator = [&](const Ray& r) { return radiance(r, world, max_depth); };
     std::vector<std::vector<Color>> pixel_colors(image_height, std::vector<Color>(image_width, Color(0, 0, 0)));
+    double render_start = omp_get_wtime();
 
-#pragma omp parallel for default(none) shared(samples_per_pixel, image_height, image_width, cam, world, pixel_colors, max_depth, lights)
-    for (int j = image_height - 1; j >=0; --j) {
-        for (int i = 0; i < image_width; ++i) {
-            Color pixel_color(0.0, 0.0, 0.0);   // Initialize pixel color
-            for (int s = 0; s < samples_per_pixel; ++s) {
-                //   std::cout << "Number of active threads = " << omp_get_thread_num() << std::endl;
-                auto u = (i + random_double()) / (image_width - 1);
-                auto v = (j + random_double()) / (image_height - 1);
+#pragma omp parallel for num_threads(num_threads)
+    for (int t = 0; t < image_height; ++t) {
+        const int j = framebuffer.get_tile(t).y0;
+        for (int i = 0; i < image_width; ++i)
+            framebuffer.at(t, i, j) = sample_pixel(sampler, cam, i, j, samples_per_pixel, image_width, image_height, integrator);
+    }
 
-                // Construct a ray from the camera origin in the direction of the sample point
-                Ray r = cam.get_ray(u, v);
+    framebuffer.resolve(pixel_colors, num_threads);
 
-                // Accumulate color for each sample
-                pixel_color += radiance(r, world, max_depth);
-            }
+    scene_info.render_time = omp_get_wtime() - render_start;
 
-            pixel_colors[j][i] = pixel_color;
-        }
-    }
+    scene_info.rays_traced = number_of_rays_traced();
 
     std::cerr << "\nDone.\n";
 
+    post_process_framebuffer(scene_info.denoiser, cam, world, sampler, samples_per_pixel, num_threads,
+                             scene_info.output_image_name, pixel_colors);
+
     // Average the colors from all samples to compute the final pixel color
     for (int j = image_height - 1; j >= 0; --j) {
         for (int i = 0; i < image_width; ++i) {
@@ -122,7 +128,8 @@ void parallel_loop_radiance_renderer(Scene_Information& scene_info) {
 // Functions that render with the radiance_background(...) function
 // -----------------------------------------------------------------------
 void parallel_loop_radiance_background_renderer(Scene_Information& scene_info) {
-    /* Parallelization Strategy: Uses the collapse(2) clause to parallelize the render loop */
+    /* Parallelization Strategy: Uses the collapse(2) clause to parallelize the render loop over groups of
+       pixels that fill whole cache lines of a Tiled_Framebuffer */
 
     // Get scene information
     // -------------------------------------------------------------------------------
@@ -136,9 +143,11 @@ void parallel_loop_radiance_background_renderer(Scene_Information& scene_info) {
 
     // World
     // -------------------------------------------------------------------------------
-    Primitives_Group world = scene_info.world;
+    const Primitive& world = scene_info.world.unwrapped();
     Primitives_Group lights = scene_info.lights;
     int samples_per_pixel = scene_info.samples_per_pixel;
+    int num_threads = scene_info.number_of_threads_used;
+    std::shared_ptr<Sampler> sampler = scene_info.sampler;
 
     // Camera
     // -------------------------------------------------------------------------------
@@ -148,6 +157,8 @@ void parallel_loop_radiance_background_renderer(Scene_Information& scene_info) {
     double vfov  = scene_info.vfov;
 
     Camera cam = scene_info.camera;
+    if (scene_info.ray_cones)
+        cam.enable_ray_cones(image_height);
 
     const std::string& file_name = scene_info.output_image_name + ".ppm";
     std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
@@ -161,30 +172,36 @@ void parallel_loop_radiance_background_renderer(Scene_Information& scene_info) {
     // -----------------------------------------------------------------------
     // Reference: How to write to a PPM file? https://www.rosettacode.org/wiki/Bitmap/Write_a_PPM_file#C++
     ofs << "P3\n" << image_width << " " << image_height << "\n255\n";
+    // Row t of the framebuffer is image row j = image_height - 1 - t. Threads are handed groups of pixels of a
+    // row that fill whole cache lines, so a line is only ever written by one thread
+    Tiled_Framebuffer framebuffer(split_into_rows(image_width, image_height));
+    const int group_size = static_cast<int>(Tiled_Framebuffer::pixels_per_line_group());
+    const int groups_per_row = (image_width + group_size - 1) / group_size;
+    auto integrator = [&](const Ray& r) { return radiance_background(r, world, max_depth); };
     std::vector<std::vector<Color>> pixel_colors(image_height, std::vector<Color>(image_width, Color(0, 0, 0)));
+    double render_start = omp_get_wtime();
+
+#pragma omp parallel for schedule(dynamic) collapse(2) num_threads(num_threads)
+    for (int t = 0; t < image_height; ++t) {
+        for (int g = 0; g < groups_per_row; ++g) {
+            const int j = framebuffer.get_tile(t).y0;
+            const int group_end = std::min(image_width, (g + 1) * group_size);
+            for (int i = g * group_size; i < group_end; ++i)
+                framebuffer.at(t, i, j) = sample_pixel(sampler, cam, i, j, samples_per_pixel, image_width, image_height, integrator);
+        }
+    }
 
-#pragma omp parallel for schedule(dynamic) collapse(2) default(none) shared(std::cout, samples_per_pixel, image_height, image_width, cam, world, pixel_colors, max_depth, lights) num_threads(16)
-    for (int j = image_height - 1; j >=0; --j) {
-        for (int i = 0; i < image_width; ++i) {
-            Color pixel_color(0.0, 0.0, 0.0);   // Initialize pixel color
-            for (int s = 0; s < samples_per_pixel; ++s) {
-                //  std::cout << "Number of active threads = " << omp_get_num_threads() << std::endl;
-                auto u = (i + random_double()) / (image_width - 1);
-                auto v = (j + random_double()) / (image_height - 1);
-
-                // Construct a ray from the camera origin in the direction of the sample point
-                Ray r = cam.get_ray(u, v);
+    framebuffer.resolve(pixel_colors, num_threads);
 
-                // Accumulate color for each sample
-                pixel_color += radiance_background(r, world, max_depth);
-            }
+    scene_info.render_time = omp_get_wtime() - render_start;
 
-            pixel_colors[j][i] = pixel_color;
-        }
-    }
+    scene_info.rays_traced = number_of_rays_traced();
 
     std::cerr << "\nDone.\n";
 
+    post_process_framebuffer(scene_info.denoiser, cam, world, sampler, samples_per_pixel, num_threads,
+                             scene_info.output_image_name, pixel_colors);
+
     // Average the colors from all samples to compute the final pixel color
     for (int j = image_height - 1; j >= 0; --j) {
         for (int i = 0; i < image_width; ++i) {
@@ -235,9 +252,11 @@ void parallel_cols_workload_radiance_background(Scene_Information& scene_info) {
 
     // World
     // -------------------------------------------------------------------------------
-    Primitives_Group world = scene_info.world;
+    const Primitive& world = scene_info.world.unwrapped();
     Primitives_Group lights = scene_info.lights;
     int samples_per_pixel = scene_info.samples_per_pixel;
+    int num_threads = scene_info.number_of_threads_used;
+    std::shared_ptr<Sampler> sampler = scene_info.sampler;
 
     // Camera
     // -------------------------------------------------------------------------------
@@ -246,6 +265,8 @@ void parallel_cols_workload_radiance_background(Scene_Information& scene_info) {
     Vec3D vup = scene_info.vup;
     double vfov  = scene_info.vfov;
     Camera cam = scene_info.camera;
+    if (scene_info.ray_cones)
+        cam.enable_ray_cones(image_height);
 
     const std::string& file_name = scene_info.output_image_name + ".ppm";
     std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
@@ -259,43 +280,41 @@ void parallel_cols_workload_radiance_background(Scene_Information& scene_info) {
     // -----------------------------------------------------------------------
     // Reference: How to write to a PPM file? https://www.rosettacode.org/wiki/Bitmap/Write_a_PPM_file#C++
     ofs << "P3\n" << image_width << " " << image_height << "\n255\n";
-
+    // Column i of the framebuffer is image column i, stored contiguously on cache lines of its own
+    Tiled_Framebuffer framebuffer(split_into_columns(image_width, image_height));
+    auto integrator = [&](const Ray& r) { return radiance_background(r, world, max_depth); };
     std::vector<std::vector<Color>> pixel_colors(image_height, std::vector<Color>(image_width, Color(0, 0, 0)));
-
-    // Determine the number of available threads
-    int num_threads = 2;
-
-    // Determine the number of columns each thread will handle
-    int cols_per_thread = image_width / num_threads;
+    double render_start = omp_get_wtime();
 
 // Render Loop with parallelization based on columns
 #pragma omp parallel num_threads(num_threads)
     {
+        // Split the columns among the threads OpenMP actually granted, which may be fewer than requested
         int thread_id = omp_get_thread_num();
+        int threads_granted = omp_get_num_threads();
+        int cols_per_thread = image_width / threads_granted;
         int start_col = thread_id * cols_per_thread;
-        int end_col = (thread_id == num_threads - 1) ? image_width : start_col + cols_per_thread;
+        int end_col = (thread_id == threads_granted - 1) ? image_width : start_col + cols_per_thread;
 
         // Loop over the assigned columns
         for (int i = start_col; i < end_col; ++i) {
-            for (int j = image_height - 1; j >= 0; --j) {
-                Color pixel_color(0.0, 0.0, 0.0);
+            for (int j = image_height - 1; j >= 0; --j)
+                framebuffer.at(i, i, j) = sample_pixel(sampler, cam, i, j, samples_per_pixel, image_width, image_height, integrator);
+        }
+    }
 
-                for (int s = 0; s < samples_per_pixel; ++s) {
-                    auto u = (i + random_double()) / (image_width - 1);
-                    auto v = (j + random_double()) / (image_height - 1);
+    framebuffer.resolve(pixel_colors, num_threads);
 
-                    Ray r = cam.get_ray(u, v);
-                    pixel_color += radiance_background(r, world, max_depth);
-                }
+    scene_info.render_time = omp_get_wtime() - render_start;
 
-                pixel_colors[j][i] = pixel_color;
-            }
-        }
-    }
+    scene_info.rays_traced = number_of_rays_traced();
 
     std::cerr << "\nDone.\n";
-    // Average the colors from all samples to compute the final pixel color
 
+    post_process_framebuffer(scene_info.denoiser, cam, world, sampler, samples_per_pixel, num_threads,
+                             scene_info.output_image_name, pixel_colors);
+
+    // Average the colors from all samples to compute the final pixel color
     for (int j = image_height - 1; j >= 0; --j) {
         for (int i = 0; i < image_width; ++i) {
             Color pixel_color = pixel_colors[j][i];
@@ -351,9 +370,11 @@ void parallel_tasks_radiance_background_renderer(Scene_Information& scene_info)
 
     // World
     // -------------------------------------------------------------------------------
-    Primitives_Group world = scene_info.world;
+    const Primitive& world = scene_info.world.unwrapped();
     Primitives_Group lights = scene_info.lights;
     int samples_per_pixel = scene_info.samples_per_pixel;
+    int num_threads = scene_info.number_of_threads_used;
+    std::shared_ptr<Sampler> sampler = scene_info.sampler;
 
     // Camera
     // -------------------------------------------------------------------------------
@@ -362,6 +383,8 @@ void parallel_tasks_radiance_background_renderer(Scene_Information& scene_info)
     Vec3D vup = scene_info.vup;
     double vfov  = scene_info.vfov;
     Camera cam = scene_info.camera;
+    if (scene_info.ray_cones)
+        cam.enable_ray_cones(image_height);
 
     const std::string& file_name = scene_info.output_image_name + ".ppm";
     std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
@@ -376,11 +399,12 @@ void parallel_tasks_radiance_background_renderer(Scene_Information& scene_info)
     // Reference: How to write to a PPM file? https://www.rosettacode.org/wiki/Bitmap/Write_a_PPM_file#C++
     ofs << "P3\n" << image_width << " " << image_height << "\n255\n";
     std::vector<std::vector<Color>> pixel_colors(image_height, std::vector<Color>(image_width, Color(0, 0, 0)));
+    double render_start = omp_get_wtime();
 
     // Get the number of available threads
     int num_of_pixels = image_width * image_height;
 
-#pragma omp parallel num_threads(16)
+#pragma omp parallel num_threads(num_threads)
 #pragma omp single
     {
         // Define the number of regions .I found that this number is empirical,
@@ -403,8 +427,10 @@ void parallel_tasks_radiance_background_renderer(Scene_Information& scene_info)
 
                     Color pixel_color(0.0, 0.0, 0.0);
                     for (int s = 0; s < samples_per_pixel; ++s) {
-                        auto u = (i + rnd(&seed)) / (image_width - 1);
-                        auto v = (j + rnd(&seed)) / (image_height - 1);
+                        start_pixel_sample(sampler, i, j, s);
+                        Vec2D pixel_offset = sampler ? sample_2D() : Vec2D(rnd(&seed), rnd(&seed));
+                        auto u = (i + pixel_offset.x()) / (image_width - 1);
+                        auto v = (j + pixel_offset.y()) / (image_height - 1);
 
                         Ray r = cam.get_ray(u, v);
                         pixel_color += radiance_background(r, world, max_depth);
@@ -416,6 +442,13 @@ void parallel_tasks_radiance_background_renderer(Scene_Information& scene_info)
         }
     }
 
+    scene_info.render_time = omp_get_wtime() - render_start;
+
+    scene_info.rays_traced = number_of_rays_traced();
+
+    post_process_framebuffer(scene_info.denoiser, cam, world, sampler, samples_per_pixel, num_threads,
+                             scene_info.output_image_name, pixel_colors);
+
     // Fill the image file with the correct order of pixels
     for (int j = image_height - 1; j >= 0; --j) {
         for (int i = 0; i < image_width; ++i) {
@@ -462,7 +495,8 @@ void parallel_tasks_radiance_background_renderer(Scene_Information& scene_info)
 // Functions that render with the radiance_mixture(...) function
 // -----------------------------------------------------------------------
 void parallel_loop_radiance_mixture_renderer(Scene_Information& scene_info) {
-    /* Parallelization Strategy: Uses the collapse(2) clause to parallelize the render loop */
+    /* Parallelization Strategy: Uses the collapse(2) clause to parallelize the render loop over groups of
+       pixels that fill whole cache lines of a Tiled_Framebuffer */
 
     // Get scene information
     // -------------------------------------------------------------------------------
@@ -476,9 +510,11 @@ void parallel_loop_radiance_mixture_renderer(Scene_Information& scene_info) {
 
     // World
     // -------------------------------------------------------------------------------
-    Primitives_Group world = scene_info.world;
+    const Primitive& world = scene_info.world.unwrapped();
     Primitives_Group lights = scene_info.lights;
     int samples_per_pixel = scene_info.samples_per_pixel;
+    int num_threads = scene_info.number_of_threads_used;
+    std::shared_ptr<Sampler> sampler = scene_info.sampler;
 
     // Camera
     // -------------------------------------------------------------------------------
@@ -487,6 +523,8 @@ void parallel_loop_radiance_mixture_renderer(Scene_Information& scene_info) {
     Vec3D vup = scene_info.vup;
     double vfov  = scene_info.vfov;
     Camera cam = scene_info.camera;
+    if (scene_info.ray_cones)
+        cam.enable_ray_cones(image_height);
 
     const std::string& file_name = scene_info.output_image_name + ".ppm";
     std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
@@ -500,31 +538,36 @@ void parallel_loop_radiance_mixture_renderer(Scene_Information& scene_info) {
     // -----------------------------------------------------------------------
     // Reference: How to write to a PPM file? https://www.rosettacode.org/wiki/Bitmap/Write_a_PPM_file#C++
     ofs << "P3\n" << image_width << " " << image_height << "\n255\n";
+    // Row t of the framebuffer is image row j = image_height - 1 - t. Threads are handed groups of pixels of a
+    // row that fill whole cache lines, so a line is only ever written by one thread
+    Tiled_Framebuffer framebuffer(split_into_rows(image_width, image_height));
+    const int group_size = static_cast<int>(Tiled_Framebuffer::pixels_per_line_group());
+    const int groups_per_row = (image_width + group_size - 1) / group_size;
+    auto integrator = [&](const Ray& r) { return radiance_mixture(r, world, lights, max_depth); };
     std::vector<std::vector<Color>> pixel_colors(image_height, std::vector<Color>(image_width, Color(0, 0, 0)));
-
-#pragma omp parallel for collapse(2) schedule(dynamic) default(none) shared(std::cout, samples_per_pixel, image_height, image_width, cam, world, pixel_colors, max_depth, lights) num_threads(16)
-    for (int j = image_height - 1; j >=0; --j) {
-        //    #pragma omp parallel for default(none) shared(samples_per_pixel, image_height, image_width, j, cam, world, lights, pixel_colors, max_depth) num_threads(16)
-        for (int i = 0; i < image_width; ++i) {
-            Color pixel_color(0.0, 0.0, 0.0);   // Initialize pixel color
-            //   #pragma omp parallel for schedule(dynamic) default(none) shared(samples_per_pixel, i, j, cam, pixel_color, world, lights, image_width, image_height, max_depth) num_threads(16)
-            for (int s = 0; s < samples_per_pixel; ++s) {
-                //   std::cout << "Number of active threads = " << omp_get_thread_num() << std::endl;
-                auto u = (i + random_double()) / (image_width - 1);
-                auto v = (j + random_double()) / (image_height - 1);
-
-                // Construct a ray from the camera origin in the direction of the sample point
-                Ray r = cam.get_ray(u, v);
-
-                // Accumulate color for each sample
-                pixel_color += radiance_mixture(r, world, lights, max_depth);
-            }
-
-            pixel_colors[j][i] = pixel_color;
+    double render_start = omp_get_wtime();
+
+#pragma omp parallel for schedule(dynamic) collapse(2) num_threads(num_threads)
+    for (int t = 0; t < image_height; ++t) {
+        for (int g = 0; g < groups_per_row; ++g) {
+            const int j = framebuffer.get_tile(t).y0;
+            const int group_end = std::min(image_width, (g + 1) * group_size);
+            for (int i = g * group_size; i < group_end; ++i)
+                framebuffer.at(t, i, j) = sample_pixel(sampler, cam, i, j, samples_per_pixel, image_width, image_height, integrator);
         }
     }
 
+    framebuffer.resolve(pixel_colors, num_threads);
+
+    scene_info.render_time = omp_get_wtime() - render_start;
+
+    scene_info.rays_traced = number_of_rays_traced();
+
     std::cerr << "\nDone.\n";
+
+    post_process_framebuffer(scene_info.denoiser, cam, world, sampler, samples_per_pixel, num_threads,
+                             scene_info.output_image_name, pixel_colors);
+
     // Average the colors from all samples to compute the final pixel color
     for (int j = image_height - 1; j >= 0; --j) {
         for (int i = 0; i < image_width; ++i) {
@@ -574,9 +617,11 @@ void parallel_cols_workload_radiance_mixture_renderer(Scene_Information& scene_i
 
     // World
     // -------------------------------------------------------------------------------
-    Primitives_Group world = scene_info.world;
+    const Primitive& world = scene_info.world.unwrapped();
     Primitives_Group lights = scene_info.lights;
     int samples_per_pixel = scene_info.samples_per_pixel;
+    int num_threads = scene_info.number_of_threads_used;
+    std::shared_ptr<Sampler> sampler = scene_info.sampler;
 
     // Camera
     // -------------------------------------------------------------------------------
@@ -585,6 +630,8 @@ void parallel_cols_workload_radiance_mixture_renderer(Scene_Information& scene_i
     Vec3D vup = scene_info.vup;
     double vfov  = scene_info.vfov;
     Camera cam = scene_info.camera;
+    if (scene_info.ray_cones)
+        cam.enable_ray_cones(image_height);
 
     const std::string& file_name = scene_info.output_image_name + ".ppm";
     std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
@@ -598,42 +645,40 @@ void parallel_cols_workload_radiance_mixture_renderer(Scene_Information& scene_i
     // -----------------------------------------------------------------------
     // Reference: How to write to a PPM file? https://www.rosettacode.org/wiki/Bitmap/Write_a_PPM_file#C++
     ofs << "P3\n" << image_width << " " << image_height << "\n255\n";
-
+    // Column i of the framebuffer is image column i, stored contiguously on cache lines of its own
+    Tiled_Framebuffer framebuffer(split_into_columns(image_width, image_height));
+    auto integrator = [&](const Ray& r) { return radiance_mixture(r, world, lights, max_depth); };
     std::vector<std::vector<Color>> pixel_colors(image_height, std::vector<Color>(image_width, Color(0, 0, 0)));
-
-    // Determine the number of available threads
-    int num_threads = 16;
-
-    // Determine the number of columns each thread will handle
-    int cols_per_thread = image_width / num_threads;
+    double render_start = omp_get_wtime();
 
 // Render Loop with parallelization based on columns
 #pragma omp parallel num_threads(num_threads)
     {
+        // Split the columns among the threads OpenMP actually granted, which may be fewer than requested
         int thread_id = omp_get_thread_num();
+        int threads_granted = omp_get_num_threads();
+        int cols_per_thread = image_width / threads_granted;
         int start_col = thread_id * cols_per_thread;
-        int end_col = (thread_id == num_threads - 1) ? image_width : start_col + cols_per_thread;
+        int end_col = (thread_id == threads_granted - 1) ? image_width : start_col + cols_per_thread;
 
         // Loop over the assigned columns
         for (int i = start_col; i < end_col; ++i) {
-            for (int j = image_height - 1; j >= 0; --j) {
-                Color pixel_color(0.0, 0.0, 0.0);
+            for (int j = image_height - 1; j >= 0; --j)
+                framebuffer.at(i, i, j) = sample_pixel(sampler, cam, i, j, samples_per_pixel, image_width, image_height, integrator);
+        }
+    }
 
-                for (int s = 0; s < samples_per_pixel; ++s) {
-                    auto u = (i + random_double()) / (image_width - 1);
-                    auto v = (j + random_double()) / (image_height - 1);
+    framebuffer.resolve(pixel_colors, num_threads);
 
-                    Ray r = cam.get_ray(u, v);
-                    pixel_color += radiance_mixture(r, world, lights, max_depth);
-                }
+    scene_info.render_time = omp_get_wtime() - render_start;
 
-                pixel_colors[j][i] = pixel_color;
-            }
-        }
-    }
+    scene_info.rays_traced = number_of_rays_traced();
 
     std::cerr << "\nDone.\n";
 
+    post_process_framebuffer(scene_info.denoiser, cam, world, sampler, samples_per_pixel, num_threads,
+                             scene_info.output_image_name, pixel_colors);
+
     // Average the colors from all samples to compute the final pixel color
     for (int j = image_height - 1; j >= 0; --j) {
         for (int i = 0; i < image_width; ++i) {
@@ -684,9 +729,11 @@ void parallel_tasks_radiance_mixture_renderer(Scene_Information& scene_info) {
 
     // World
     // -------------------------------------------------------------------------------
-    Primitives_Group world = scene_info.world;
+    const Primitive& world = scene_info.world.unwrapped();
     Primitives_Group lights = scene_info.lights;
     int samples_per_pixel = scene_info.samples_per_pixel;
+    int num_threads = scene_info.number_of_threads_used;
+    std::shared_ptr<Sampler> sampler = scene_info.sampler;
 
     // Camera
     // -------------------------------------------------------------------------------
@@ -695,6 +742,8 @@ void parallel_tasks_radiance_mixture_renderer(Scene_Information& scene_info) {
     Vec3D vup = scene_info.vup;
     double vfov  = scene_info.vfov;
     Camera cam = scene_info.camera;
+    if (scene_info.ray_cones)
+        cam.enable_ray_cones(image_height);
 
     const std::string& file_name = scene_info.output_image_name + ".ppm";
     std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
@@ -709,11 +758,13 @@ void parallel_tasks_radiance_mixture_renderer(Scene_Information& scene_info) {
     // Reference: How to write to a PPM file? https://www.rosettacode.org/wiki/Bitmap/Write_a_PPM_file#C++
     ofs << "P3\n" << image_width << " " << image_height << "\n255\n";
     std::vector<std::vector<Color>> pixel_colors(image_height, std::vector<Color>(image_width, Color(0, 0, 0)));
+    double render_start = omp_get_wtime();
 
     // Get the number of available threads
     int num_of_pixels = image_width * image_height;
+    auto integrator = [&](const Ray& r) { return radiance_mixture(r, world, lights, max_depth); };
 
-#pragma omp parallel num_threads(16)        // 128   2000 is best
+#pragma omp parallel num_threads(num_threads)        // 128   2000 is best
 #pragma omp single
     {
         // Define the number of regions .I found that this number is empirical,
@@ -734,24 +785,23 @@ void parallel_tasks_radiance_mixture_renderer(Scene_Information& scene_info) {
                     int i = iter % image_width;
                     int j = iter / image_width;
 
-                    Color pixel_color(0.0, 0.0, 0.0);
-                    for (int s = 0; s < samples_per_pixel; ++s) {
-                        auto u = (i + random_double()) / (image_width - 1);
-                        auto v = (j + random_double()) / (image_height - 1);
-
-                        Ray r = cam.get_ray(u, v);
-                        pixel_color += radiance_mixture(r, world, lights, max_depth);
-                    }
-
-                    pixel_colors[j][i] = pixel_color;
+                    pixel_colors[j][i] = sample_pixel(sampler, cam, i, j, samples_per_pixel, image_width, image_height, integrator);
                 }
             }
         }
     }
 
 
+    scene_info.render_time = omp_get_wtime() - render_start;
+
+
+    scene_info.rays_traced = number_of_rays_traced();
+
     std::cerr << "\nDone.\n";
 
+    post_process_framebuffer(scene_info.denoiser, cam, world, sampler, samples_per_pixel, num_threads,
+                             scene_info.output_image_name, pixel_colors);
+
     // Fill the image file with the correct order of pixels
     for (int j = image_height - 1; j >= 0; --j) {
         for (int i = 0; i < image_width; ++i) {
@@ -786,4 +836,105 @@ void parallel_tasks_radiance_mixture_renderer(Scene_Information& scene_info) {
 
     std::cout << "Name of file rendered: " << scene_info.output_image_name << std::endl;
 }
+
+void parallel_tiles_radiance_mixture_renderer(Scene_Information& scene_info) {
+    /* Parallelization Strategy: dynamic scheduling of 16x16 tiles, each written to its own cache lines of a
+       Tiled_Framebuffer (no false sharing between threads), then copied into pixel_colors in parallel */
+
+    // Get scene information
+    // -------------------------------------------------------------------------------
+
+    // Image
+    // -------------------------------------------------------------------------------
+    const auto aspect_ratio = scene_info.aspect_ratio;
+    const int image_width = scene_info.image_width;
+    const int image_height = static_cast<int>(image_width / aspect_ratio);
+    int max_depth = scene_info.max_depth;
+
+    // World
+    // -------------------------------------------------------------------------------
+    const Primitive& world = scene_info.world.unwrapped();
+    Primitives_Group lights = scene_info.lights;
+    int samples_per_pixel = scene_info.samples_per_pixel;
+    int num_threads = scene_info.number_of_threads_used;
+    std::shared_ptr<Sampler> sampler = scene_info.sampler;
+
+    // Camera
+    // -------------------------------------------------------------------------------
+    Camera cam = scene_info.camera;
+    if (scene_info.ray_cones)
+        cam.enable_ray_cones(image_height);
+
+    const std::string& file_name = scene_info.output_image_name + ".ppm";
+    std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
+
+    std::cout << "Image height = " << image_height << std::endl;
+    std::cout << "Image Width = " << image_width << std::endl;
+    std::cout << "Depth = " << max_depth << std::endl;
+    std::cout << "Samples-per-pixel = " << samples_per_pixel << std::endl;
+
+    // Render Loop
+    // -----------------------------------------------------------------------
+    ofs << "P3\n" << image_width << " " << image_height << "\n255\n";
+    Tiled_Framebuffer framebuffer(image_width, image_height);
+    const int number_of_tiles = framebuffer.number_of_tiles();
+    auto integrator = [&](const Ray& r) { return radiance_mixture(r, world, lights, max_depth); };
+    std::vector<std::vector<Color>> pixel_colors(image_height, std::vector<Color>(image_width, Color(0, 0, 0)));
+    double render_start = omp_get_wtime();
+
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+    for (int t = 0; t < number_of_tiles; ++t) {
+        const Image_Tile& tile = framebuffer.get_tile(t);
+        for (int j = tile.y1 - 1; j >= tile.y0; --j) {
+            for (int i = tile.x0; i < tile.x1; ++i)
+                framebuffer.at(t, i, j) = sample_pixel(sampler, cam, i, j, samples_per_pixel, image_width, image_height, integrator);
+        }
+    }
+
+    framebuffer.resolve(pixel_colors, num_threads);
+
+    scene_info.render_time = omp_get_wtime() - render_start;
+
+    scene_info.rays_traced = number_of_rays_traced();
+
+    std::cerr << "\nDone.\n";
+
+    post_process_framebuffer(scene_info.denoiser, cam, world, sampler, samples_per_pixel, num_threads,
+                             scene_info.output_image_name, pixel_colors);
+
+    // Fill the image file with the correct order of pixels
+    for (int j = image_height - 1; j >= 0; --j) {
+        for (int i = 0; i < image_width; ++i) {
+            Color pixel_color = pixel_colors[j][i];
+
+            // Average the colors from all samples
+            pixel_color /= samples_per_pixel;
+
+            // Apply 2-gamma
+            double r_comp = pixel_color.x();
+            double g_comp = pixel_color.y();
+            double b_comp = pixel_color.z();
+
+            // Get rid of acne: white or black dots
+            if (std::isnan(r_comp))
+                r_comp = 0.0;
+            if (std::isnan(g_comp))
+                g_comp = 0.0;
+            if (std::isnan(b_comp))
+                b_comp = 0.0;
+
+            r_comp = gamma_2_correction(r_comp);
+            g_comp = gamma_2_correction(g_comp);
+            b_comp = gamma_2_correction(b_comp);
+
+            // Write the averaged color to the PPM file
+            ofs << static_cast<int>(255 * clamp(r_comp, 0.0, 0.999)) << ' '
+                << static_cast<int>(255 * clamp(g_comp, 0.0, 0.999)) << ' '
+                << static_cast<int>(255 * clamp(b_comp, 0.0, 0.999)) << '\n';
+        }
+    }
+
+    std::cout << "Name of file rendered: " << scene_info.output_image_name << std::endl;
+}
+
 #endif //CUDA_RAY_TRACER_PARALLEL_RENDERING_FUNCTIONS_H
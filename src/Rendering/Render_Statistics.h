@@ -0,0 +1,76 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_RENDER_STATISTICS_H
+#define CUDA_RAY_TRACER_RENDER_STATISTICS_H
+
+#include <mutex>
+#include <vector>
+#include <algorithm>
+
+// Counts the rays traced into the world by the radiance(...) functions, for rays/second figures.
+// Every thread counts into its own counter, so counting costs one increment per ray and no
+// synchronization; number_of_rays_traced() adds the counters up (call it when no render is running).
+// -----------------------------------------------------------------------
+class Ray_Counters {
+public:
+    static Ray_Counters& instance() {
+        static Ray_Counters counters;
+        return counters;
+    }
+
+    long long total() {
+        std::lock_guard<std::mutex> lock(mutex);
+        long long sum = retired;
+        for (const long long* c : counters)
+            sum += *c;
+        return sum;
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex);
+        retired = 0;
+        for (long long* c : counters)
+            *c = 0;
+    }
+
+    void add_thread_counter(long long* c) {
+        std::lock_guard<std::mutex> lock(mutex);
+        counters.push_back(c);
+    }
+
+    void remove_thread_counter(long long* c) {
+        // A thread is exiting: keep what it counted
+        std::lock_guard<std::mutex> lock(mutex);
+        retired += *c;
+        counters.erase(std::remove(counters.begin(), counters.end(), c), counters.end());
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<long long*> counters;
+    long long retired = 0;
+};
+
+struct Thread_Ray_Counter {
+    long long rays = 0;
+
+    Thread_Ray_Counter() { Ray_Counters::instance().add_thread_counter(&rays); }
+    ~Thread_Ray_Counter() { Ray_Counters::instance().remove_thread_counter(&rays); }
+};
+
+inline void count_ray() {
+    static thread_local Thread_Ray_Counter counter;
+    counter.rays++;
+}
+
+inline long long number_of_rays_traced() {
+    return Ray_Counters::instance().total();
+}
+
+inline void reset_ray_counters() {
+    Ray_Counters::instance().reset();
+}
+
+#endif //CUDA_RAY_TRACER_RENDER_STATISTICS_H
@@ -18,29 +18,43 @@ void serial_radiance_renderer(Scene_Information& scene_info) {
     const std::string& file_name = scene_info.output_image_name + ".ppm";
     std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
 
+    Camera cam = scene_info.camera;
+    if (scene_info.ray_cones)
+        cam.enable_ray_cones(scene_info.image_height);
 
     // Render Loop
     // -----------------------------------------------------------------------
 
     // Reference: [3] How to write to a PPM file? https://www.rosettacode.org/wiki/Bitmap/Write_a_PPM_file#C++
     ofs << "P3\n" << scene_info.image_width << " " << scene_info.image_height << "\n255\n";
+    std::vector<std::vector<Color>> pixel_colors(scene_info.image_height, std::vector<Color>(scene_info.image_width, Color(0, 0, 0)));
+    double render_start = omp_get_wtime();
     for (int j = scene_info.image_height - 1; j >=0; --j) {
         for (int i = 0; i < scene_info.image_width; ++i) {
             Color pixel_color(0.0, 0.0, 0.0);
             for (int s = 0; s < scene_info.samples_per_pixel; ++s) {
-                auto u = (i + random_double()) / (scene_info.image_width - 1);
-                auto v = (j + random_double()) / (scene_info.image_height - 1);
+                start_pixel_sample(scene_info.sampler, i, j, s);
+                Vec2D pixel_offset = sample_2D();
+                auto u = (i + pixel_offset.x()) / (scene_info.image_width - 1);
+                auto v = (j + pixel_offset.y()) / (scene_info.image_height - 1);
 
                 // Construct a ray from the camera origin in the direction of the sample point
-                Ray r = scene_info.camera.get_ray(u, v);
+                Ray r = cam.get_ray(u, v);
 
                 // Accumulate color for each sample
-                pixel_color += radiance(r, scene_info.world, scene_info.max_depth);
+                pixel_color += radiance(r, scene_info.world.unwrapped(), scene_info.max_depth);
             }
             // Average color over all samples
-            pixel_color /= scene_info.samples_per_pixel;
+            pixel_colors[j][i] = pixel_color / scene_info.samples_per_pixel;
+        }
+    }
+    scene_info.render_time = omp_get_wtime() - render_start;
+    scene_info.rays_traced = number_of_rays_traced();
 
-            // Write the color to the output file
+    // Write the colors to the output file
+    for (int j = scene_info.image_height - 1; j >=0; --j) {
+        for (int i = 0; i < scene_info.image_width; ++i) {
+            const Color& pixel_color = pixel_colors[j][i];
             int ir = static_cast<int>(256 * clamp(pixel_color.x(), 0.0, 0.999));
             int ig = static_cast<int>(256 * clamp(pixel_color.y(), 0.0, 0.999));
             int ib = static_cast<int>(256 * clamp(pixel_color.z(), 0.0, 0.999));
@@ -0,0 +1,97 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_TILE_RENDERING_FUNCTIONS_H
+#define CUDA_RAY_TRACER_TILE_RENDERING_FUNCTIONS_H
+
+#include "../Utilities.h"
+#include "../Cameras/Camera.h"
+#include "../Shading.h"
+#include "../Scenes.h"
+
+// Rendering one rectangle of the image at a time, for the tile-distributed renderer (Tools/render_coordinator.cpp):
+// the coordinator splits the image into tiles and the workers render them with render_tile_radiance_mixture().
+// Pixel (i,j) gets the same samples as in parallel_loop_radiance_mixture_renderer(), whatever tile it is in.
+// -----------------------------------------------------------------------
+struct Image_Tile {
+    int x0, y0;                     // first pixel
+    int x1, y1;                     // one past the last pixel
+};
+
+inline std::vector<Image_Tile> split_into_tiles(int image_width, int image_height, int tile_size) {
+    // Row-major from the top of the image, so a preview fills in the way the renderers write the image
+
+    std::vector<Image_Tile> tiles;
+    for (int y1 = image_height; y1 > 0; y1 -= tile_size)
+        for (int x0 = 0; x0 < image_width; x0 += tile_size)
+            tiles.push_back({x0, std::max(0, y1 - tile_size), std::min(image_width, x0 + tile_size), y1});
+    return tiles;
+}
+
+inline std::vector<Image_Tile> split_into_rows(int image_width, int image_height) {
+    // One tile per row, from the top of the image
+
+    std::vector<Image_Tile> rows;
+    for (int j = image_height - 1; j >= 0; --j)
+        rows.push_back({0, j, image_width, j + 1});
+    return rows;
+}
+
+inline std::vector<Image_Tile> split_into_columns(int image_width, int image_height) {
+    // One tile per column, from the left of the image
+
+    std::vector<Image_Tile> columns;
+    for (int i = 0; i < image_width; ++i)
+        columns.push_back({i, 0, i + 1, image_height});
+    return columns;
+}
+
+// Per-Pixel Work
+// -----------------------------------------------------------------------
+template <typename Radiance>
+inline Color sample_pixel(const std::shared_ptr<Sampler>& sampler, const Camera& cam, int i, int j, int samples_per_pixel,
+                          int image_width, int image_height, const Radiance& radiance) {
+    // The sum of the samples of pixel (i,j), the body of every renderer's loop; radiance(r) is the integrator
+
+    Color pixel_color(0.0, 0.0, 0.0);
+    for (int s = 0; s < samples_per_pixel; ++s) {
+        start_pixel_sample(sampler, i, j, s);
+        Vec2D pixel_offset = sample_2D();
+        auto u = (i + pixel_offset.x()) / (image_width - 1);
+        auto v = (j + pixel_offset.y()) / (image_height - 1);
+
+        // Construct a ray from the camera origin in the direction of the sample point
+        Ray r = cam.get_ray(u, v);
+        pixel_color += radiance(r);
+    }
+    return pixel_color;
+}
+
+inline void render_tile_radiance_mixture(const Scene_Information& scene_info, const Camera& cam, const Image_Tile& tile,
+                                         std::vector<Color>& sums) {
+    // sums gets the sum of the samples of every pixel of the tile, row by row from (x0,y0)
+
+    const int image_width = scene_info.image_width;
+    const int image_height = scene_info.image_height;
+    const int tile_width = tile.x1 - tile.x0;
+    const int tile_height = tile.y1 - tile.y0;
+    int max_depth = scene_info.max_depth;
+    int samples_per_pixel = scene_info.samples_per_pixel;
+    int num_threads = scene_info.number_of_threads_used;
+    const Primitive& world = scene_info.world.unwrapped();
+    const Primitives_Group& lights = scene_info.lights;
+    std::shared_ptr<Sampler> sampler = scene_info.sampler;
+
+    sums.assign(tile_width * tile_height, Color(0, 0, 0));
+    auto mixture = [&](const Ray& r) { return radiance_mixture(r, world, lights, max_depth); };
+
+#pragma omp parallel for schedule(dynamic) collapse(2) num_threads(num_threads)
+    for (int j = tile.y0; j < tile.y1; ++j) {
+        for (int i = tile.x0; i < tile.x1; ++i)
+            sums[(j - tile.y0) * tile_width + (i - tile.x0)] =
+                    sample_pixel(sampler, cam, i, j, samples_per_pixel, image_width, image_height, mixture);
+    }
+}
+
+#endif //CUDA_RAY_TRACER_TILE_RENDERING_FUNCTIONS_H
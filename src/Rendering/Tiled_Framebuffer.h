@@ -0,0 +1,106 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_TILED_FRAMEBUFFER_H
+#define CUDA_RAY_TRACER_TILED_FRAMEBUFFER_H
+
+#include "../Utilities.h"
+#include "Tile_Rendering_Functions.h"
+
+/// Reference: Intel 64 and IA-32 Architectures Optimization Reference Manual - Section 8.4.5: False Sharing
+// A framebuffer stored tile by tile rather than row by row, for renderers that hand whole tiles to threads.
+// Every tile's pixels start on a cache line of their own and fill a whole number of cache lines, so two
+// threads never write to the same line. In pixel_colors a 64-byte line holds 2 2/3 Colors, and with the
+// pixels of a row going to different threads (collapse(2) with dynamic scheduling) neighbouring pixels'
+// writes keep taking the line from each other's caches.
+//
+// Tiles are any split of the image into Image_Tiles: the squares of split_into_tiles() by default, or the rows
+// or columns of split_into_rows() and split_into_columns() for renderers that hand out rows or columns. Pixel
+// (i,j) of tile t is at(t, i, j). A renderer that hands out parts of a row gives each thread whole groups of
+// pixels_per_line_group() pixels, which then fill whole cache lines. Once the render loop is done, resolve()
+// copies the tiles into pixel_colors, in parallel, one tile per thread at a time.
+// -----------------------------------------------------------------------
+class Tiled_Framebuffer {
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    Tiled_Framebuffer(int image_width, int image_height, int tile_size = 16) :
+            Tiled_Framebuffer(split_into_tiles(image_width, image_height, tile_size)) {}
+
+    explicit Tiled_Framebuffer(std::vector<Image_Tile> image_tiles) : tiles(std::move(image_tiles)) {
+        // Tiles are padded to a multiple of the smallest run of pixels that ends on a line boundary (8 Colors
+        // in 3 lines), so that every tile starts on a new line
+        const size_t group = pixels_per_line_group();
+
+        size_t offset = 0;
+        for (const Image_Tile& tile : tiles) {
+            first_pixel.push_back(offset);
+            size_t tile_pixels = static_cast<size_t>(tile.x1 - tile.x0) * (tile.y1 - tile.y0);
+            offset += (tile_pixels + group - 1) / group * group;
+        }
+
+        storage.reset(new char[offset * sizeof(Color) + cache_line_size]);
+        uintptr_t base = reinterpret_cast<uintptr_t>(storage.get());
+        pixels = reinterpret_cast<Color*>((base + cache_line_size - 1) / cache_line_size * cache_line_size);
+        number_of_pixels = offset;
+        for (size_t k = 0; k < number_of_pixels; k++)
+            new (pixels + k) Color(0, 0, 0);
+    }
+
+    Tiled_Framebuffer(const Tiled_Framebuffer&) = delete;
+    Tiled_Framebuffer& operator=(const Tiled_Framebuffer&) = delete;
+
+    // Access
+    // -----------------------------------------------------------------------
+    static size_t pixels_per_line_group() { return cache_line_size / gcd(cache_line_size, sizeof(Color)); }
+
+    int number_of_tiles() const { return static_cast<int>(tiles.size()); }
+
+    const Image_Tile& get_tile(int t) const { return tiles[t]; }
+
+    Color& at(int t, int i, int j) {
+        const Image_Tile& tile = tiles[t];
+        return pixels[first_pixel[t] + (j - tile.y0) * (tile.x1 - tile.x0) + (i - tile.x0)];
+    }
+
+    const Color& at(int t, int i, int j) const {
+        const Image_Tile& tile = tiles[t];
+        return pixels[first_pixel[t] + (j - tile.y0) * (tile.x1 - tile.x0) + (i - tile.x0)];
+    }
+
+    void clear_tile(int t) {
+        const Image_Tile& tile = tiles[t];
+        std::fill(pixels + first_pixel[t], pixels + first_pixel[t] + (tile.x1 - tile.x0) * (tile.y1 - tile.y0), Color(0, 0, 0));
+    }
+
+    // Reduction
+    // -----------------------------------------------------------------------
+    void resolve(std::vector<std::vector<Color>>& pixel_colors, int num_threads) const {
+        // pixel_colors[j][i] = at(tile of (i,j), i, j). Threads copy whole tiles, so the only lines of
+        // pixel_colors that two threads share are the few at the left and right edges of a tile.
+
+        const int n = number_of_tiles();
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int t = 0; t < n; t++) {
+            const Image_Tile& tile = tiles[t];
+            for (int j = tile.y0; j < tile.y1; ++j)
+                std::copy(&at(t, tile.x0, j), &at(t, tile.x0, j) + (tile.x1 - tile.x0), &pixel_colors[j][tile.x0]);
+        }
+    }
+
+private:
+    static size_t gcd(size_t a, size_t b) { return b == 0 ? a : gcd(b, a % b); }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    static const size_t cache_line_size = 64;
+
+    std::vector<Image_Tile> tiles;
+    std::vector<size_t> first_pixel;            // index in pixels of each tile's first pixel, always on a new cache line
+    std::unique_ptr<char[]> storage;
+    Color* pixels = nullptr;                    // storage, aligned to a cache line
+    size_t number_of_pixels = 0;
+};
+
+#endif //CUDA_RAY_TRACER_TILED_FRAMEBUFFER_H
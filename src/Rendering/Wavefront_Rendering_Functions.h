@@ -0,0 +1,553 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_WAVEFRONT_RENDERING_FUNCTIONS_H
+#define CUDA_RAY_TRACER_WAVEFRONT_RENDERING_FUNCTIONS_H
+
+#include "../Utilities.h"
+#include "../Cameras/Camera.h"
+#include "../Shading.h"
+#include "../Scenes.h"
+#include "../Materials/Material_Table.h"
+
+/// Reference: Megakernels Considered Harmful: Wavefront Path Tracing on GPUs - https://research.nvidia.com/publication/2013-07_megakernels-considered-harmful-wavefront-path-tracing-gpus
+// The other renderers trace one path at a time: radiance_mixture(...) intersects, shades, and recurses, so
+// consecutive rays come from unrelated code paths and materials. The wavefront renderer instead advances a
+// whole wave of paths one bounce at a time, in stages:
+//      1. camera:     generate the camera rays of the wave
+//      2. intersect:  intersect every ray of the queue with the world
+//      3. sort:       group the hits by MATERIAL_TYPE (and put the misses in their own group)
+//      4. shade:      shade each group with its own loop, calling its material class directly
+//      5. compact:    move the paths that are still alive to the front of the queue, and go to 2
+//      (1b. bin:      optionally, reorder the secondary rays by direction and origin before 2)
+// The path state lives in a structure of arrays (Wavefront_Paths), and so do the hits (Wavefront_Hits).
+//
+// It computes the same estimator as radiance_mixture(...) (a 50/50 mixture of light and surface sampling,
+// black background), so the image converges to the one of the other *_radiance_mixture_renderer functions.
+// -----------------------------------------------------------------------
+const int WAVEFRONT_MISS = NUMBER_OF_MATERIAL_TYPES;           // the group of the rays that hit nothing
+const int NUMBER_OF_WAVEFRONT_GROUPS = NUMBER_OF_MATERIAL_TYPES + 1;
+
+struct Wavefront_Paths {
+    // The state of the paths in flight; path k is element k of every array
+
+    std::vector<double> origin_x, origin_y, origin_z;
+    std::vector<double> direction_x, direction_y, direction_z;
+    std::vector<double> time;
+    std::vector<double> cone_width, cone_spread;                        // the ray cone (see Ray)
+    std::vector<double> throughput_r, throughput_g, throughput_b;       // product of BRDF * cos / pdf so far
+    std::vector<int> slot;                                              // index of the path in the wave
+    std::vector<int> depth;                                             // bounces left
+    std::vector<int> dimension;                                         // where the path's sample vector is
+
+    int size() const { return static_cast<int>(slot.size()); }
+
+    void resize(int n) {
+        origin_x.resize(n); origin_y.resize(n); origin_z.resize(n);
+        direction_x.resize(n); direction_y.resize(n); direction_z.resize(n);
+        time.resize(n);
+        cone_width.resize(n); cone_spread.resize(n);
+        throughput_r.resize(n); throughput_g.resize(n); throughput_b.resize(n);
+        slot.resize(n);
+        depth.resize(n);
+        dimension.resize(n);
+    }
+
+    Ray get_ray(int k) const {
+        Ray r(point3D(origin_x[k], origin_y[k], origin_z[k]), Vec3D(direction_x[k], direction_y[k], direction_z[k]), time[k]);
+        r.set_cone(cone_width[k], cone_spread[k]);
+        return r;
+    }
+
+    void set_ray(int k, const Ray& r) {
+        point3D o = r.get_ray_origin();
+        Vec3D d = r.get_ray_direction();
+        origin_x[k] = o.x(); origin_y[k] = o.y(); origin_z[k] = o.z();
+        direction_x[k] = d.x(); direction_y[k] = d.y(); direction_z[k] = d.z();
+        time[k] = r.get_time();
+        cone_width[k] = r.cone_width; cone_spread[k] = r.cone_spread;
+    }
+
+    Color get_throughput(int k) const {
+        return Color(throughput_r[k], throughput_g[k], throughput_b[k]);
+    }
+
+    void set_throughput(int k, const Color& c) {
+        throughput_r[k] = c.x(); throughput_g[k] = c.y(); throughput_b[k] = c.z();
+    }
+
+    void copy(const Wavefront_Paths& from_paths, int from, int to) {
+        // Copies path "from" of from_paths over path "to" (used to reorder the queue)
+
+        origin_x[to] = from_paths.origin_x[from]; origin_y[to] = from_paths.origin_y[from]; origin_z[to] = from_paths.origin_z[from];
+        direction_x[to] = from_paths.direction_x[from]; direction_y[to] = from_paths.direction_y[from]; direction_z[to] = from_paths.direction_z[from];
+        time[to] = from_paths.time[from];
+        cone_width[to] = from_paths.cone_width[from]; cone_spread[to] = from_paths.cone_spread[from];
+        throughput_r[to] = from_paths.throughput_r[from]; throughput_g[to] = from_paths.throughput_g[from]; throughput_b[to] = from_paths.throughput_b[from];
+        slot[to] = from_paths.slot[from];
+        depth[to] = from_paths.depth[from];
+        dimension[to] = from_paths.dimension[from];
+    }
+
+    void move(int from, int to) {
+        // Copies path "from" over path "to" (used to compact the queue)
+
+        origin_x[to] = origin_x[from]; origin_y[to] = origin_y[from]; origin_z[to] = origin_z[from];
+        direction_x[to] = direction_x[from]; direction_y[to] = direction_y[from]; direction_z[to] = direction_z[from];
+        time[to] = time[from];
+        cone_width[to] = cone_width[from]; cone_spread[to] = cone_spread[from];
+        throughput_r[to] = throughput_r[from]; throughput_g[to] = throughput_g[from]; throughput_b[to] = throughput_b[from];
+        slot[to] = slot[from];
+        depth[to] = depth[from];
+        dimension[to] = dimension[from];
+    }
+};
+
+struct Wavefront_Hits {
+    // The closest hit of each path of the queue; hit k belongs to path k
+
+    std::vector<double> p_x, p_y, p_z;
+    std::vector<double> normal_x, normal_y, normal_z;
+    std::vector<double> t, u, v;
+    std::vector<double> uv_per_unit_length, cone_width;
+    std::vector<unsigned char> front_face;
+    std::vector<unsigned char> group;                   // the MATERIAL_TYPE of the hit, or WAVEFRONT_MISS
+    std::vector<Material*> material;
+
+    void resize(int n) {
+        p_x.resize(n); p_y.resize(n); p_z.resize(n);
+        normal_x.resize(n); normal_y.resize(n); normal_z.resize(n);
+        t.resize(n); u.resize(n); v.resize(n);
+        uv_per_unit_length.resize(n); cone_width.resize(n);
+        front_face.resize(n);
+        group.resize(n);
+        material.resize(n);
+    }
+
+    void set(int k, const Intersection_Information& rec) {
+        p_x[k] = rec.p.x(); p_y[k] = rec.p.y(); p_z[k] = rec.p.z();
+        normal_x[k] = rec.normal.x(); normal_y[k] = rec.normal.y(); normal_z[k] = rec.normal.z();
+        t[k] = rec.t; u[k] = rec.u; v[k] = rec.v;
+        uv_per_unit_length[k] = rec.uv_per_unit_length; cone_width[k] = rec.cone_width;
+        front_face[k] = rec.front_face;
+        material[k] = rec.mat_ptr.get();
+        group[k] = material[k]->get_type();
+    }
+
+    Intersection_Information get(int k) const {
+        // The hit as the materials expect it. mat_ptr is left empty: the shading stage already knows the material.
+
+        Intersection_Information rec;
+        rec.p = point3D(p_x[k], p_y[k], p_z[k]);
+        rec.normal = Vec3D(normal_x[k], normal_y[k], normal_z[k]);
+        rec.t = t[k]; rec.u = u[k]; rec.v = v[k];
+        rec.uv_per_unit_length = uv_per_unit_length[k]; rec.cone_width = cone_width[k];
+        rec.front_face = front_face[k] != 0;
+        return rec;
+    }
+};
+
+/// Reference: Fast Ray Sorting and Breadth-First Packet Traversal for GPU Ray Tracing - https://doi.org/10.1111/j.1467-8659.2009.01598.x
+// Ray binning key: the direction's octant in bits 27-29, above the 27-bit Morton code of the origin
+// quantized to a 512^3 grid over the scene bounds. Rays with equal keys leave from nearby points in the
+// same general direction, so they tend to visit the same BVH nodes.
+// -----------------------------------------------------------------------
+inline uint32_t expand_bits_10(uint32_t v) {
+    // Spreads the 10 low bits of v so that there are two zeros between consecutive bits
+
+    v = (v * 0x00010001u) & 0xFF0000FFu;
+    v = (v * 0x00000101u) & 0x0F00F00Fu;
+    v = (v * 0x00000011u) & 0xC30C30C3u;
+    v = (v * 0x00000005u) & 0x49249249u;
+    return v;
+}
+
+inline uint32_t ray_binning_key(const point3D& origin, const Vec3D& direction, const point3D& scene_min, const Vec3D& inverse_scene_extent) {
+    uint32_t octant = (direction.x() < 0 ? 4u : 0u) | (direction.y() < 0 ? 2u : 0u) | (direction.z() < 0 ? 1u : 0u);
+
+    uint32_t cell[3];
+    for (int a = 0; a < 3; a++) {
+        double x = (origin[a] - scene_min[a]) * inverse_scene_extent[a];
+        cell[a] = static_cast<uint32_t>(clamp(x * 512.0, 0.0, 511.0));
+    }
+
+    return (octant << 27) | (expand_bits_10(cell[0]) << 2) | (expand_bits_10(cell[1]) << 1) | expand_bits_10(cell[2]);
+}
+
+class Wavefront_Integrator {
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    Wavefront_Integrator(const Primitive& world, const Primitive& lights, const Camera& cam, const std::shared_ptr<Sampler>& sampler,
+                         int image_width, int image_height, int samples_per_pixel, int max_depth, int num_threads,
+                         bool sort_secondary_rays = false) :
+            world(world), lights(lights), cam(cam), sampler(sampler), image_width(image_width), image_height(image_height),
+            samples_per_pixel(samples_per_pixel), max_depth(max_depth), num_threads(num_threads),
+            sort_secondary_rays(sort_secondary_rays) {
+
+        AABB scene_box;
+        if (sort_secondary_rays && world.has_bounding_box(0.0, 1.0, scene_box)) {
+            scene_min = scene_box.get_min();
+            Vec3D extent = scene_box.get_max() - scene_box.get_min();
+            for (int a = 0; a < 3; a++)
+                inverse_scene_extent[a] = extent[a] > 0.0 ? 1.0 / extent[a] : 0.0;
+        }
+    }
+
+    // Rendering
+    // -----------------------------------------------------------------------
+    void render(std::vector<std::vector<Color>>& pixel_colors, int wave_size = 1 << 12) {
+        // Adds the radiance of every sample to pixel_colors[j][i]. Sample s of pixel (i,j) is path
+        // number (j * image_width + i) * samples_per_pixel + s; the paths are traced wave_size at a time.
+
+        long long number_of_paths = static_cast<long long>(image_width) * image_height * samples_per_pixel;
+        if (max_depth <= 0)
+            return;
+
+        for (long long first_path = 0; first_path < number_of_paths; first_path += wave_size) {
+            int paths_in_wave = static_cast<int>(std::min<long long>(wave_size, number_of_paths - first_path));
+
+            generate_camera_rays(first_path, paths_in_wave);
+            for (int bounce = 0; paths.size() > 0; bounce++) {
+                // Camera rays are already coherent: they leave in pixel order
+                if (sort_secondary_rays && bounce > 0)
+                    bin_rays();
+                intersect();
+                sort_by_material();
+                shade();
+                compact();
+            }
+
+            // Accumulate in path order, so each pixel sums its samples in the same order as the other renderers
+            for (int k = 0; k < paths_in_wave; k++) {
+                long long pixel = (first_path + k) / samples_per_pixel;
+                pixel_colors[pixel / image_width][pixel % image_width] += path_radiance[k];
+            }
+        }
+    }
+
+private:
+    // Stages
+    // -----------------------------------------------------------------------
+    void generate_camera_rays(long long first_path, int paths_in_wave) {
+        wave_start = first_path;
+        paths.resize(paths_in_wave);
+        alive.assign(paths_in_wave, 1);
+        path_radiance.assign(paths_in_wave, Color(0, 0, 0));
+
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int k = 0; k < paths_in_wave; k++) {
+            int i, j, s;
+            pixel_sample(k, i, j, s);
+
+            start_pixel_sample(sampler, i, j, s);
+            Vec2D pixel_offset = sample_2D();
+            auto u = (i + pixel_offset.x()) / (image_width - 1);
+            auto v = (j + pixel_offset.y()) / (image_height - 1);
+
+            paths.set_ray(k, cam.get_ray(u, v));
+            paths.set_throughput(k, Color(1, 1, 1));
+            paths.slot[k] = k;
+            paths.depth[k] = max_depth;
+            paths.dimension[k] = save_dimension();
+        }
+    }
+
+    void bin_rays() {
+        // Reorders the queue by ray_binning_key(), so that consecutive rays touch similar BVH nodes
+
+        int n = paths.size();
+        keys.resize(n);
+
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int k = 0; k < n; k++) {
+            uint32_t key = ray_binning_key(point3D(paths.origin_x[k], paths.origin_y[k], paths.origin_z[k]),
+                                           Vec3D(paths.direction_x[k], paths.direction_y[k], paths.direction_z[k]),
+                                           scene_min, inverse_scene_extent);
+            keys[k] = (static_cast<uint64_t>(key) << 32) | static_cast<uint32_t>(k);
+        }
+
+        std::sort(keys.begin(), keys.end());
+
+        binned_paths.resize(n);
+        for (int k = 0; k < n; k++)
+            binned_paths.copy(paths, static_cast<int>(keys[k] & 0xFFFFFFFFu), k);
+        std::swap(paths, binned_paths);
+    }
+
+    void intersect() {
+        int n = paths.size();
+        hits.resize(n);
+
+#pragma omp parallel for schedule(dynamic, 256) num_threads(num_threads)
+        for (int k = 0; k < n; k++) {
+            Intersection_Information rec;
+            Ray r = paths.get_ray(k);
+            count_ray();
+            if (world.intersection(r, 0.001, infinity, rec)) {
+                rec.cone_width = r.cone_width_at(rec.t);
+                hits.set(k, rec);
+            } else
+                hits.group[k] = WAVEFRONT_MISS;
+        }
+    }
+
+    void sort_by_material() {
+        // Counting sort of the queue's indices by material; group g is order[group_start[g] .. group_start[g+1])
+
+        int n = paths.size();
+        int counts[NUMBER_OF_WAVEFRONT_GROUPS] = {0};
+        for (int k = 0; k < n; k++)
+            counts[hits.group[k]]++;
+
+        group_start[0] = 0;
+        for (int g = 0; g < NUMBER_OF_WAVEFRONT_GROUPS; g++)
+            group_start[g + 1] = group_start[g] + counts[g];
+
+        int next[NUMBER_OF_WAVEFRONT_GROUPS];
+        std::copy(group_start, group_start + NUMBER_OF_WAVEFRONT_GROUPS, next);
+        order.resize(n);
+        for (int k = 0; k < n; k++)
+            order[next[hits.group[k]]++] = k;
+    }
+
+    void shade() {
+        shade_misses();
+        shade_group<DIFFUSE>();
+        shade_group<DIFFUSE_WITH_TEXTURE>();
+        shade_group<UNIFORM_HEMISPHERICAL_DIFFUSE>();
+        shade_group<DISNEY_DIFFUSE>();
+        shade_group<PHONG>();
+        shade_group<SPECULAR>();
+        shade_group<DIFFUSE_LIGHT>();
+    }
+
+    void compact() {
+        // Keeps the paths that scattered, in queue order
+
+        int n = paths.size();
+        int m = 0;
+        for (int k = 0; k < n; k++) {
+            if (alive[k]) {
+                if (k != m)
+                    paths.move(k, m);
+                alive[m] = 1;
+                m++;
+            }
+        }
+        paths.resize(m);
+        alive.resize(m);
+    }
+
+    // Shading
+    // -----------------------------------------------------------------------
+    void shade_misses() {
+        // The background is black, as in the other *_radiance_mixture_renderer functions
+
+        for (int q = group_start[WAVEFRONT_MISS]; q < group_start[WAVEFRONT_MISS + 1]; q++)
+            alive[order[q]] = 0;
+    }
+
+    template <MATERIAL_TYPE TYPE>
+    void shade_group() {
+        int begin = group_start[TYPE];
+        int end = group_start[TYPE + 1];
+
+#pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads)
+        for (int q = begin; q < end; q++)
+            shade_path(order[q], static_cast<const typename Material_Class<TYPE>::type&>(*hits.material[order[q]]));
+    }
+
+    template <typename Concrete_Material>
+    void shade_path(int k, const Concrete_Material& material) {
+        // One bounce of radiance_mixture(...) for path k: add its emission, then scatter it or end it
+
+        int i, j, s;
+        pixel_sample(paths.slot[k], i, j, s);
+        resume_pixel_sample(sampler, i, j, s, paths.dimension[k]);
+
+        Ray r = paths.get_ray(k);
+        Intersection_Information rec = hits.get(k);
+        Color throughput = paths.get_throughput(k);
+        Color& L = path_radiance[paths.slot[k]];
+        alive[k] = 0;
+
+        Color color_from_emission = material.emitted(rec);
+
+        Material_Sample sample = material.sample(r, rec);
+        if (!sample.scattered) {
+            L += throughput * color_from_emission;
+            return;
+        }
+
+        Ray scattered_ray = sample.scattered_ray;
+        if (sample.is_specular) {
+            // radiance_mixture(...) does not add the emission of a mirror-like bounce
+            throughput = throughput * sample.color;
+        } else {
+            L += throughput * color_from_emission;
+
+            auto light_ptr = std::make_shared<Primitive_PDF>(lights, rec.p);
+            Mixture_PDF mixture_pdf(light_ptr, sample.surface_pdf_ptr);
+
+            scattered_ray = Ray(rec.p, mixture_pdf.generate_a_random_direction_based_on_PDF(), r.get_time());
+            double new_pdf = mixture_pdf.PDF_value(scattered_ray.get_ray_direction());
+            if (new_pdf == 0.0)
+                return;
+
+            throughput = throughput * material.eval(r, rec, scattered_ray, sample.color) / new_pdf;
+        }
+
+        paths.depth[k]--;
+        if (paths.depth[k] <= 0)
+            return;
+
+        propagate_ray_cone(r, rec, sample.is_specular, scattered_ray);
+        paths.set_ray(k, scattered_ray);
+        paths.set_throughput(k, throughput);
+        paths.dimension[k] = save_dimension();
+        alive[k] = 1;
+    }
+
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    void pixel_sample(int slot, int& i, int& j, int& s) const {
+        // Pixel and sample index of the path in the given slot of the current wave
+
+        long long path = wave_start + slot;
+        long long pixel = path / samples_per_pixel;
+        s = static_cast<int>(path % samples_per_pixel);
+        i = static_cast<int>(pixel % image_width);
+        j = static_cast<int>(pixel / image_width);
+    }
+
+    static int save_dimension() {
+        return active_sampler() ? active_sampler()->get_dimension() : 0;
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    const Primitive& world;
+    const Primitive& lights;
+    const Camera& cam;
+    std::shared_ptr<Sampler> sampler;
+    int image_width, image_height, samples_per_pixel, max_depth, num_threads;
+    bool sort_secondary_rays;
+    point3D scene_min;                                      // the grid of ray_binning_key()
+    Vec3D inverse_scene_extent;
+
+    long long wave_start = 0;                               // path number of slot 0
+    Wavefront_Paths paths;                                  // the queue
+    Wavefront_Hits hits;
+    std::vector<unsigned char> alive;                       // alive[k]: path k continues after this bounce
+    std::vector<int> order;                                 // queue indices sorted by material
+    int group_start[NUMBER_OF_WAVEFRONT_GROUPS + 1];
+    std::vector<Color> path_radiance;                       // radiance of each slot of the wave
+    std::vector<uint64_t> keys;                             // bin_rays(): binning key << 32 | queue index
+    Wavefront_Paths binned_paths;                           // bin_rays(): the reordered queue
+};
+
+// Functions that render with the wavefront integrator
+// -----------------------------------------------------------------------
+void render_wavefront_radiance_mixture(Scene_Information& scene_info, bool sort_secondary_rays) {
+    /* Parallelization Strategy: every stage is a parallel loop over the ray queue */
+
+    // Get scene information
+    // -------------------------------------------------------------------------------
+
+    // Image
+    // -------------------------------------------------------------------------------
+    const auto aspect_ratio = scene_info.aspect_ratio;
+    const int image_width = scene_info.image_width;
+    const int image_height = static_cast<int>(image_width / aspect_ratio);
+    int max_depth = scene_info.max_depth;
+
+    // World
+    // -------------------------------------------------------------------------------
+    const Primitive& world = scene_info.world.unwrapped();
+    Primitives_Group lights = scene_info.lights;
+    int samples_per_pixel = scene_info.samples_per_pixel;
+    int num_threads = scene_info.number_of_threads_used;
+    std::shared_ptr<Sampler> sampler = scene_info.sampler;
+
+    // Camera
+    // -------------------------------------------------------------------------------
+    Camera cam = scene_info.camera;
+    if (scene_info.ray_cones)
+        cam.enable_ray_cones(image_height);
+
+    const std::string& file_name = scene_info.output_image_name + ".ppm";
+    std::ofstream ofs(file_name, std::ios_base::out | std::ios_base::binary);
+
+    std::cout << "Image height = " << image_height << std::endl;
+    std::cout << "Image Width = " << image_width << std::endl;
+    std::cout << "Depth = " << max_depth << std::endl;
+    std::cout << "Samples-per-pixel = " << samples_per_pixel << std::endl;
+
+    // Render Loop
+    // -----------------------------------------------------------------------
+    // Reference: How to write to a PPM file? https://www.rosettacode.org/wiki/Bitmap/Write_a_PPM_file#C++
+    ofs << "P3\n" << image_width << " " << image_height << "\n255\n";
+    std::vector<std::vector<Color>> pixel_colors(image_height, std::vector<Color>(image_width, Color(0, 0, 0)));
+    double render_start = omp_get_wtime();
+
+    Wavefront_Integrator integrator(world, lights, cam, sampler, image_width, image_height, samples_per_pixel, max_depth, num_threads,
+                                    sort_secondary_rays);
+    integrator.render(pixel_colors);
+
+    scene_info.render_time = omp_get_wtime() - render_start;
+
+    scene_info.rays_traced = number_of_rays_traced();
+
+    std::cerr << "\nDone.\n";
+
+    post_process_framebuffer(scene_info.denoiser, cam, world, sampler, samples_per_pixel, num_threads,
+                             scene_info.output_image_name, pixel_colors);
+
+    // Fill the image file with the correct order of pixels
+    for (int j = image_height - 1; j >= 0; --j) {
+        for (int i = 0; i < image_width; ++i) {
+            Color pixel_color = pixel_colors[j][i];
+
+            // Average the colors from all samples
+            pixel_color /= samples_per_pixel;
+
+            // Apply 2-gamma
+            double r_comp = pixel_color.x();
+            double g_comp = pixel_color.y();
+            double b_comp = pixel_color.z();
+
+            // Get rid of acne: white or black dots
+            if (std::isnan(r_comp))
+                r_comp = 0.0;
+            if (std::isnan(g_comp))
+                g_comp = 0.0;
+            if (std::isnan(b_comp))
+                b_comp = 0.0;
+
+            r_comp = gamma_2_correction(r_comp);
+            g_comp = gamma_2_correction(g_comp);
+            b_comp = gamma_2_correction(b_comp);
+
+            // Write the averaged color to the PPM file
+            ofs << static_cast<int>(255 * clamp(r_comp, 0.0, 0.999)) << ' '
+                << static_cast<int>(255 * clamp(g_comp, 0.0, 0.999)) << ' '
+                << static_cast<int>(255 * clamp(b_comp, 0.0, 0.999)) << '\n';
+        }
+    }
+
+    std::cout << "Name of file rendered: " << scene_info.output_image_name << std::endl;
+}
+
+void wavefront_radiance_mixture_renderer(Scene_Information& scene_info) {
+    render_wavefront_radiance_mixture(scene_info, false);
+}
+
+void wavefront_sorted_radiance_mixture_renderer(Scene_Information& scene_info) {
+    // The secondary rays are binned by direction and origin before every bounce
+
+    render_wavefront_radiance_mixture(scene_info, true);
+}
+
+#endif //CUDA_RAY_TRACER_WAVEFRONT_RENDERING_FUNCTIONS_H
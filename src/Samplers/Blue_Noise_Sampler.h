@@ -0,0 +1,150 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_BLUE_NOISE_SAMPLER_H
+#define CUDA_RAY_TRACER_BLUE_NOISE_SAMPLER_H
+
+#include "Sobol_Sampler.h"
+
+/// References:         - Blue-noise Dithered Sampling (Georgiev & Fajardo 2016)
+///                     - The void-and-cluster method for dither array generation (Ulichney 1993)
+// All pixels use the same scrambled Sobol sample vectors, each shifted (Cranley-Patterson rotation)
+// by the value of a blue noise mask at the pixel. The error then stays within every pixel, but
+// what is left of it is spread as blue noise across the image, which looks much less noisy than
+// white noise at low sample counts. Every dimension reads the mask at a different offset.
+class Blue_Noise_Sampler : public Sampler {
+public:
+    // Constructor
+    // -----------------------------------------------------------------------
+    explicit Blue_Noise_Sampler(uint64_t seed = 0) : seed(seed) {
+        blue_noise_mask();                  // build the mask now rather than in the render loop
+    }
+
+    // Overridden Functions
+    // -----------------------------------------------------------------------
+    double get_1D() override {
+        double value = Sobol_Sampler::scrambled_sobol(static_cast<uint32_t>(index), dimension,
+                                                      hash_ints(dimension / 4, seed));
+
+        uint64_t offset = hash_ints(dimension, seed, 0xb1e);
+        int x = (px + static_cast<int>(offset & 0xffff)) & (mask_size - 1);
+        int y = (py + static_cast<int>((offset >> 16) & 0xffff)) & (mask_size - 1);
+        value += blue_noise_mask()[y * mask_size + x];
+
+        dimension++;
+        return value >= 1.0 ? value - 1.0 : value;
+    }
+
+    std::shared_ptr<Sampler> clone() const override {
+        return std::make_shared<Blue_Noise_Sampler>(*this);
+    }
+
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    static const int mask_size = 64;                    // the mask is tiled over the image
+
+    static const std::vector<double>& blue_noise_mask() {
+        static const std::vector<double> mask = void_and_cluster();
+        return mask;
+    }
+
+private:
+    static std::vector<double> void_and_cluster() {
+        // Ranks the mask_size x mask_size pixels so that, for every n, the first n of them form a
+        // blue noise point set. The energy of a pixel is the sum of a toroidal Gaussian over all
+        // the pixels already in the set; tight clusters have high energy, large voids low energy.
+
+        const int N = mask_size * mask_size;
+        const double sigma = 1.5;
+
+        std::vector<double> kernel(N);
+        for (int dy = 0; dy < mask_size; dy++) {
+            for (int dx = 0; dx < mask_size; dx++) {
+                int tx = std::min(dx, mask_size - dx);
+                int ty = std::min(dy, mask_size - dy);
+                kernel[dy * mask_size + dx] = exp(-(tx * tx + ty * ty) / (2 * sigma * sigma));
+            }
+        }
+
+        std::vector<char> pattern(N, 0);
+        std::vector<double> energy(N, 0.0);
+
+        auto splat = [&](std::vector<double>& e, int p, double sign) {
+            int px = p % mask_size, py = p / mask_size;
+            for (int y = 0; y < mask_size; y++) {
+                int ky = ((y - py) & (mask_size - 1)) * mask_size;
+                for (int x = 0; x < mask_size; x++)
+                    e[y * mask_size + x] += sign * kernel[ky + ((x - px) & (mask_size - 1))];
+            }
+        };
+        auto tightest_cluster = [&](const std::vector<char>& pat, const std::vector<double>& e) {
+            int best = -1;
+            for (int i = 0; i < N; i++)
+                if (pat[i] && (best < 0 || e[i] > e[best])) best = i;
+            return best;
+        };
+        auto largest_void = [&](const std::vector<char>& pat, const std::vector<double>& e) {
+            int best = -1;
+            for (int i = 0; i < N; i++)
+                if (!pat[i] && (best < 0 || e[i] < e[best])) best = i;
+            return best;
+        };
+
+        // Initial binary pattern: 10% of the pixels at (hashed) random positions...
+        int ones = 0;
+        for (uint64_t k = 0; ones < N / 10; k++) {
+            int p = static_cast<int>(mix_bits(k + 1) % N);
+            if (!pattern[p]) {
+                pattern[p] = 1;
+                splat(energy, p, 1.0);
+                ones++;
+            }
+        }
+
+        // ... relaxed by moving the tightest cluster into the largest void until nothing moves
+        for (int iteration = 0; iteration < N; iteration++) {
+            int cluster = tightest_cluster(pattern, energy);
+            pattern[cluster] = 0;
+            splat(energy, cluster, -1.0);
+
+            int hole = largest_void(pattern, energy);
+            pattern[hole] = 1;
+            splat(energy, hole, 1.0);
+
+            if (hole == cluster)
+                break;
+        }
+
+        std::vector<int> rank(N, 0);
+
+        // Phase 1: rank the initial points by removing the tightest cluster each time
+        std::vector<char> pat = pattern;
+        std::vector<double> e = energy;
+        for (int r = ones - 1; r >= 0; r--) {
+            int cluster = tightest_cluster(pat, e);
+            pat[cluster] = 0;
+            splat(e, cluster, -1.0);
+            rank[cluster] = r;
+        }
+
+        // Phase 2: rank the remaining pixels by filling the largest void each time
+        for (int r = ones; r < N; r++) {
+            int hole = largest_void(pattern, energy);
+            pattern[hole] = 1;
+            splat(energy, hole, 1.0);
+            rank[hole] = r;
+        }
+
+        std::vector<double> mask(N);
+        for (int i = 0; i < N; i++)
+            mask[i] = (rank[i] + 0.5) / N;
+        return mask;
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    uint64_t seed;
+};
+
+#endif //CUDA_RAY_TRACER_BLUE_NOISE_SAMPLER_H
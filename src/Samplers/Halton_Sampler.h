@@ -0,0 +1,84 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_HALTON_SAMPLER_H
+#define CUDA_RAY_TRACER_HALTON_SAMPLER_H
+
+#include "Sampler.h"
+#include "../Utilities.h"
+
+/// Reference: Physically Based Rendering (4th ed.) - Section 8.6: Halton Sampler
+// The Halton sequence: dimension d is the radical inverse of the sample index in the d-th prime.
+// Every pixel gets its own Owen scrambling of the digits, so neighbouring pixels are decorrelated
+// while each keeps the low discrepancy of the sequence. Dimensions past the prime table fall back
+// to hashed random numbers.
+class Halton_Sampler : public Sampler {
+public:
+    // Constructor
+    // -----------------------------------------------------------------------
+    explicit Halton_Sampler(uint64_t seed = 0) : seed(seed) {}
+
+    // Overridden Functions
+    // -----------------------------------------------------------------------
+    double get_1D() override {
+        double value;
+        if (dimension < number_of_primes)
+            value = owen_scrambled_radical_inverse(primes()[dimension], static_cast<uint64_t>(index),
+                                                   static_cast<uint32_t>(hash_ints(hash_ints(px, py), dimension, seed)));
+        else
+            value = hashed_1D(seed);
+
+        dimension++;
+        return value;
+    }
+
+    std::shared_ptr<Sampler> clone() const override {
+        return std::make_shared<Halton_Sampler>(*this);
+    }
+
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    /// Reference: Physically Based Rendering (4th ed.) - Section 8.6.2: Randomization via Scrambling
+    static double owen_scrambled_radical_inverse(int base, uint64_t a, uint32_t hash) {
+        // Mirrors the base-b digits of a around the decimal point. Each digit is permuted by a
+        // permutation that depends on all the digits before it (Owen scrambling). The loop keeps
+        // going after a runs out of digits, because the scrambled zero digits are not zero.
+
+        const double one_minus_epsilon = 1.0 - epsilon;
+        double inv_base = 1.0 / base;
+        double inv_base_m = 1;
+        uint64_t reversed_digits = 0;
+
+        while (1 - (base - 1) * inv_base_m < 1) {
+            uint64_t next = a / base;
+            int digit_value = static_cast<int>(a - next * base);
+
+            uint32_t digit_hash = static_cast<uint32_t>(mix_bits(hash ^ reversed_digits));
+            digit_value = permutation_element(digit_value, base, digit_hash);
+
+            reversed_digits = reversed_digits * base + digit_value;
+            inv_base_m *= inv_base;
+            a = next;
+        }
+
+        return fmin(inv_base_m * reversed_digits, one_minus_epsilon);
+    }
+
+private:
+    static const int number_of_primes = 32;
+
+    static const int* primes() {
+        static const int table[number_of_primes] = {
+                2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53,
+                59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131
+        };
+        return table;
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    uint64_t seed;
+};
+
+#endif //CUDA_RAY_TRACER_HALTON_SAMPLER_H
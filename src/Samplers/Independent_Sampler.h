@@ -0,0 +1,27 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_INDEPENDENT_SAMPLER_H
+#define CUDA_RAY_TRACER_INDEPENDENT_SAMPLER_H
+
+#include "Sampler.h"
+#include "../Utilities.h"
+
+// Independent uniform random numbers for every dimension. This is what the renderer does when
+// no sampler is set; it is here as the baseline to compare the other samplers against.
+class Independent_Sampler : public Sampler {
+public:
+    // Overridden Functions
+    // -----------------------------------------------------------------------
+    double get_1D() override {
+        dimension++;
+        return random_double();
+    }
+
+    std::shared_ptr<Sampler> clone() const override {
+        return std::make_shared<Independent_Sampler>(*this);
+    }
+};
+
+#endif //CUDA_RAY_TRACER_INDEPENDENT_SAMPLER_H
@@ -0,0 +1,160 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_SAMPLER_H
+#define CUDA_RAY_TRACER_SAMPLER_H
+
+#include <cstdint>
+#include <memory>
+#include "../Mathematics/Vec2D.h"
+
+/// Reference: Physically Based Rendering: From Theory to Implementation (4th ed.) - Chapter 8: Sampling and Reconstruction
+// A Sampler hands out the sample values of one pixel sample, one dimension at a time. The renderer
+// calls start_pixel_sample() before tracing each camera ray, and every later call to get_1D()/get_2D()
+// (pixel jitter, lens, time, light and BSDF sampling along the path) uses the next dimension of the
+// sample vector. Samplers keep per-pixel state, so each thread works with its own clone().
+class Sampler {
+public:
+    virtual ~Sampler() = default;
+
+    // Sampling Interface
+    // -----------------------------------------------------------------------
+    virtual void start_pixel_sample(int pixel_x, int pixel_y, int sample_index) {
+        // Begins a new sample vector for pixel (pixel_x,pixel_y)
+
+        px = pixel_x;
+        py = pixel_y;
+        index = sample_index;
+        dimension = 0;
+    }
+
+    virtual double get_1D() = 0;                // next sample value in [0,1)
+
+    virtual Vec2D get_2D() {
+        // Next two dimensions, for 2D sampling (directions, points on lights, the lens...)
+
+        double u1 = get_1D();
+        double u2 = get_1D();
+        return {u1, u2};
+    }
+
+    virtual std::shared_ptr<Sampler> clone() const = 0;
+
+    // Where the current sample vector is; a renderer that interleaves many paths on one thread (the
+    // wavefront renderer) saves it after each stage and restores it with resume_pixel_sample()
+    int get_dimension() const { return dimension; }
+    void set_dimension(int d) { dimension = d; }
+
+protected:
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    double hashed_1D(uint64_t seed) const;      // a deterministic "random" value for the current pixel sample and dimension
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    int px = 0, py = 0;             // current pixel
+    int index = 0;                  // index of the current sample in the pixel
+    int dimension = 0;              // next dimension to be consumed
+};
+
+// Supporting Functions
+// -----------------------------------------------------------------------
+/// Reference: Better Bit Mixing - Improving on MurmurHash3's 64-bit Finalizer: https://zimbry.blogspot.com/2011/09/better-bit-mixing-improving-on.html
+inline uint64_t mix_bits(uint64_t v) {
+    v ^= (v >> 31);
+    v *= 0x7fb5d329728ea185ULL;
+    v ^= (v >> 27);
+    v *= 0x81dadef4bc2dd44dULL;
+    v ^= (v >> 33);
+    return v;
+}
+
+inline uint64_t hash_ints(uint64_t a, uint64_t b, uint64_t c = 0, uint64_t d = 0) {
+    // Hashes up to four integers into one 64-bit value (used to seed per-pixel/per-dimension scrambles)
+
+    return mix_bits(mix_bits(mix_bits(mix_bits(a) ^ b) ^ c) ^ d);
+}
+
+inline double uint32_to_unit_double(uint32_t x) {
+    // Maps a 32-bit integer to [0,1)
+
+    return x * (1.0 / 4294967296.0);
+}
+
+/// Reference: Correlated Multi-Jittered Sampling - https://graphics.pixar.com/library/MultiJitteredSampling/paper.pdf
+inline int permutation_element(uint32_t i, uint32_t l, uint32_t p) {
+    // Returns element i of a random permutation of {0,...,l-1}, selected by p, without storing it
+
+    uint32_t w = l - 1;
+    w |= w >> 1;
+    w |= w >> 2;
+    w |= w >> 4;
+    w |= w >> 8;
+    w |= w >> 16;
+    do {
+        i ^= p;
+        i *= 0xe170893d;
+        i ^= p >> 16;
+        i ^= (i & w) >> 4;
+        i ^= p >> 8;
+        i *= 0x0929eb3f;
+        i ^= p >> 23;
+        i ^= (i & w) >> 1;
+        i *= 1 | p >> 27;
+        i *= 0x6935fa69;
+        i ^= (i & w) >> 11;
+        i *= 0x74dcb303;
+        i ^= (i & w) >> 2;
+        i *= 0x9e501cc3;
+        i ^= (i & w) >> 2;
+        i *= 0xc860a3df;
+        i &= w;
+        i ^= i >> 5;
+    } while (i >= l);
+    return static_cast<int>((i + p) % l);
+}
+
+inline double Sampler::hashed_1D(uint64_t seed) const {
+    return uint32_to_unit_double(static_cast<uint32_t>(hash_ints(hash_ints(px, py), index, dimension, seed) >> 32));
+}
+
+// Active Sampler
+// -----------------------------------------------------------------------
+inline Sampler*& active_sampler() {
+    // The sampler used by the calling thread, or nullptr to draw independent random numbers
+
+    static thread_local Sampler* sampler = nullptr;
+    return sampler;
+}
+
+inline void start_pixel_sample(const std::shared_ptr<Sampler>& prototype, int pixel_x, int pixel_y, int sample_index) {
+    // Called by the renderers before each camera ray. Every thread gets its own clone of the
+    // scene's sampler the first time it sees it; a null prototype turns the samplers off.
+
+    static thread_local std::shared_ptr<Sampler> thread_sampler;
+    static thread_local std::shared_ptr<Sampler> cloned_from;           // held, so its address cannot be reused
+
+    if (!prototype) {
+        active_sampler() = nullptr;
+        return;
+    }
+
+    if (cloned_from != prototype) {
+        thread_sampler = prototype->clone();
+        cloned_from = prototype;
+    }
+
+    thread_sampler->start_pixel_sample(pixel_x, pixel_y, sample_index);
+    active_sampler() = thread_sampler.get();
+}
+
+inline void resume_pixel_sample(const std::shared_ptr<Sampler>& prototype, int pixel_x, int pixel_y, int sample_index, int dimension) {
+    // Like start_pixel_sample(), but continues the sample vector at "dimension" instead of starting it over
+
+    start_pixel_sample(prototype, pixel_x, pixel_y, sample_index);
+    if (active_sampler())
+        active_sampler()->set_dimension(dimension);
+}
+
+#endif //CUDA_RAY_TRACER_SAMPLER_H
@@ -0,0 +1,125 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_SOBOL_SAMPLER_H
+#define CUDA_RAY_TRACER_SOBOL_SAMPLER_H
+
+#include "Sampler.h"
+#include "../Utilities.h"
+
+/// References:         - Practical Hash-based Owen Scrambling (Burley 2020): https://jcgt.org/published/0009/04/01/
+///                     - Constructing Sobol sequences with better two-dimensional projections (Joe & Kuo 2008)
+// Owen-scrambled Sobol points. Only the first four Sobol dimensions are used (they are the well
+// distributed ones); longer sample vectors are padded with independently shuffled and scrambled
+// copies of that 4D set, one per group of four dimensions. The scrambles are seeded per pixel.
+// Use a power of two samples_per_pixel to get the full stratification of the sequence.
+class Sobol_Sampler : public Sampler {
+public:
+    // Constructor
+    // -----------------------------------------------------------------------
+    explicit Sobol_Sampler(uint64_t seed = 0) : seed(seed) {}
+
+    // Overridden Functions
+    // -----------------------------------------------------------------------
+    double get_1D() override {
+        double value = scrambled_sobol(static_cast<uint32_t>(index), dimension,
+                                       hash_ints(hash_ints(px, py), dimension / 4, seed));
+        dimension++;
+        return value;
+    }
+
+    std::shared_ptr<Sampler> clone() const override {
+        return std::make_shared<Sobol_Sampler>(*this);
+    }
+
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    static double scrambled_sobol(uint32_t sample_index, int dim, uint64_t group_seed) {
+        // Dimension dim of the shuffled, Owen-scrambled 4D Sobol point number sample_index.
+        // All dimensions of one group of four share group_seed, so they share the shuffle.
+
+        uint32_t shuffled_index = nested_uniform_scramble(sample_index, static_cast<uint32_t>(group_seed));
+        uint32_t dim_seed = static_cast<uint32_t>(mix_bits(group_seed ^ (dim % 4 + 1)));
+
+        return uint32_to_unit_double(nested_uniform_scramble(sobol(shuffled_index, dim % 4), dim_seed));
+    }
+
+    static uint32_t sobol(uint32_t sample_index, int dim) {
+        // Multiplies the index by the generator matrix of the dimension (dim in [0,4))
+
+        const uint32_t* V = direction_numbers()[dim];
+        uint32_t X = 0;
+        for (int bit = 0; sample_index; bit++, sample_index >>= 1) {
+            if (sample_index & 1)
+                X ^= V[bit];
+        }
+        return X;
+    }
+
+    static uint32_t reverse_bits(uint32_t x) {
+        x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+        x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+        x = ((x >> 4) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4);
+        x = ((x >> 8) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8);
+        return (x >> 16) | (x << 16);
+    }
+
+    static uint32_t laine_karras_permutation(uint32_t x, uint32_t seed) {
+        // Every bit is flipped depending only on the bits below it, which are the higher
+        // digits once the bits are reversed
+        x += seed;
+        x ^= x * 0x6c50b47cu;
+        x ^= x * 0xb82f1e52u;
+        x ^= x * 0xc7afe638u;
+        x ^= x * 0x8d22f6e6u;
+        return x;
+    }
+
+    static uint32_t nested_uniform_scramble(uint32_t x, uint32_t seed) {
+        // Owen scrambling of a 32-bit fixed point value in [0,1)
+
+        x = reverse_bits(x);
+        x = laine_karras_permutation(x, seed);
+        x = reverse_bits(x);
+        return x;
+    }
+
+private:
+    typedef uint32_t Direction_Numbers[32];
+
+    static const Direction_Numbers* direction_numbers() {
+        // Generator matrices of the first four Sobol dimensions, built once from the
+        // primitive polynomials and initial numbers of Joe & Kuo (new-joe-kuo-6.21201)
+        static const struct Table {
+            Direction_Numbers V[4];
+
+            Table() {
+                for (int bit = 0; bit < 32; bit++)
+                    V[0][bit] = 1u << (31 - bit);                   // van der Corput
+
+                const int s[3] = {1, 2, 3};                         // polynomial degrees
+                const int a[3] = {0, 1, 1};                         // polynomial coefficients
+                const uint32_t m[3][3] = {{1, 0, 0}, {1, 3, 0}, {1, 3, 1}};
+
+                for (int d = 0; d < 3; d++) {
+                    uint32_t* v = V[d + 1];
+                    for (int i = 0; i < s[d]; i++)
+                        v[i] = m[d][i] << (31 - i);
+                    for (int i = s[d]; i < 32; i++) {
+                        v[i] = v[i - s[d]] ^ (v[i - s[d]] >> s[d]);
+                        for (int k = 1; k < s[d]; k++)
+                            v[i] ^= ((a[d] >> (s[d] - 1 - k)) & 1) * v[i - k];
+                    }
+                }
+            }
+        } table;
+        return table.V;
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    uint64_t seed;
+};
+
+#endif //CUDA_RAY_TRACER_SOBOL_SAMPLER_H
@@ -0,0 +1,64 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_STRATIFIED_SAMPLER_H
+#define CUDA_RAY_TRACER_STRATIFIED_SAMPLER_H
+
+#include "Sampler.h"
+#include "../Utilities.h"
+
+/// Reference: Physically Based Rendering (4th ed.) - Section 8.5: Stratified Sampler
+// Jittered stratified sampling. The samples of a pixel are split into x_strata * y_strata strata;
+// every dimension visits each stratum exactly once, in an order that is shuffled per pixel and per
+// dimension so that the dimensions are not correlated with each other.
+// samples_per_pixel should be x_strata * y_strata; sample indices past that wrap around.
+class Stratified_Sampler : public Sampler {
+public:
+    // Constructor
+    // -----------------------------------------------------------------------
+    Stratified_Sampler(int x_strata, int y_strata, bool jitter = true, uint64_t seed = 0) :
+            x_strata(x_strata), y_strata(y_strata), jitter(jitter), seed(seed) {}
+
+    // Overridden Functions
+    // -----------------------------------------------------------------------
+    double get_1D() override {
+        int number_of_strata = x_strata * y_strata;
+        uint64_t hash = hash_ints(hash_ints(px, py), dimension, seed);
+        int stratum = permutation_element(index % number_of_strata, number_of_strata, static_cast<uint32_t>(hash));
+
+        double delta = jitter ? hashed_1D(seed) : 0.5;
+        dimension++;
+
+        return fmin((stratum + delta) / number_of_strata, 1.0 - epsilon);
+    }
+
+    Vec2D get_2D() override {
+        // One stratum of the x_strata * y_strata grid
+
+        int number_of_strata = x_strata * y_strata;
+        uint64_t hash = hash_ints(hash_ints(px, py), dimension, seed);
+        int stratum = permutation_element(index % number_of_strata, number_of_strata, static_cast<uint32_t>(hash));
+        int x = stratum % x_strata;
+        int y = stratum / x_strata;
+
+        double dx = jitter ? hashed_1D(seed) : 0.5;
+        double dy = jitter ? hashed_1D(seed ^ 0x9e3779b97f4a7c15ULL) : 0.5;
+        dimension += 2;
+
+        return {fmin((x + dx) / x_strata, 1.0 - epsilon), fmin((y + dy) / y_strata, 1.0 - epsilon)};
+    }
+
+    std::shared_ptr<Sampler> clone() const override {
+        return std::make_shared<Stratified_Sampler>(*this);
+    }
+
+private:
+    // Data Members
+    // -----------------------------------------------------------------------
+    int x_strata, y_strata;
+    bool jitter;                    // jitter inside the strata, or take their centers
+    uint64_t seed;
+};
+
+#endif //CUDA_RAY_TRACER_STRATIFIED_SAMPLER_H
@@ -0,0 +1,539 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_SCENE_FILE_H
+#define CUDA_RAY_TRACER_SCENE_FILE_H
+
+#include "Scenes.h"
+#include <map>
+
+// Scenes described in a text file and loaded at run time, so that a scene can be changed without recompiling:
+//
+//      Scene_Information scene_info = load_scene_file("scenes/motion_blur.scene");
+//
+// One statement per line; '#' starts a comment. A statement is a keyword followed by parameters, each a name
+// and then its values: the numbers that follow it, or else a single word or "quoted string". Textures and
+// materials are given a name and a type first, and are referred to by that name later on:
+//
+//      image width 800 aspect_ratio 1
+//      render samples_per_pixel 256 max_depth 30 sampler sobol threads 16
+//      output name "Cornell Box"
+//      camera lookfrom 278 278 -800 lookat 278 278 0 vup 0 1 0 vfov 40 aperture 20 focus_point 285 60 190 shutter 0 1
+//      accelerator builder bvh_flat                    # see BVH_builder_name()
+//      lights sampling group                           # group, power or light_bvh (see Light_Sampler)
+//
+//      texture gold constant color 1 0.84 0
+//      texture gold_stripes stripes first gold second burgundy width 20 interpolate 1
+//      texture wood image file "textures/wood.ppm"
+//      material white diffuse color 0.73 0.73 0.73
+//      material striped diffuse texture gold_stripes
+//      material mirror specular color 0.81 0.85 0.88 fuzz 0 index_of_refraction 1
+//      material lamp light color 30 30 30
+//
+//      sphere center 190 90 190 radius 90 material white
+//      moving_sphere center0 140 60 190 center1 140 160 190 radius 60 material white     # moves while the shutter is open
+//      rectangle plane xz min 213 554 227 max 343 554 332 material lamp
+//      triangle v0 0 0 0 v1 1 0 0 v2 0 1 0 material white
+//      box min 0 0 0 max 165 165 165 material white rotate_y -18 translate 90 0 65
+//      mesh file "models/bunny.obj" material white scale 700 rotate_y -59.5 translate 130 140 150
+//
+// Every primitive takes translate x y z, scale s (or sx sy sz) and rotate_x/rotate_y/rotate_z degrees, applied
+// in the order they are written. Meshes and triangles have their vertices transformed; the other primitives
+// are wrapped in a Transform. Primitives with a light material are also the scene's lights (for importance
+// sampling), unless they are wrapped in a Transform, which cannot be sampled. Relative file names are relative
+// to the scene file. Mistakes (unknown keywords or parameters, missing values, undefined names) stop the
+// program with the line they are on.
+// -----------------------------------------------------------------------
+class Scene_File_Parser {
+public:
+    // Constructor
+    // -----------------------------------------------------------------------
+    explicit Scene_File_Parser(const std::string& file_name) : file_name(file_name) {
+        size_t slash = file_name.find_last_of("/\\");
+        directory = (slash == std::string::npos) ? "" : file_name.substr(0, slash + 1);
+    }
+
+    // Parsing
+    // -----------------------------------------------------------------------
+    Scene_Information parse() {
+        std::ifstream scene_file(file_name);
+        if (!scene_file.is_open()) {
+            std::cerr << "ERROR: UNABLE TO OPEN SCENE FILE " << file_name << std::endl;
+            exit(0);
+        }
+
+        set_defaults();
+
+        std::string line;
+        while (std::getline(scene_file, line)) {
+            line_number++;
+            std::vector<Token> tokens = tokenize(line);
+            if (!tokens.empty())
+                parse_statement(tokens);
+        }
+
+        return finish();
+    }
+
+private:
+    // Tokens and Parameters
+    // -----------------------------------------------------------------------
+    struct Token {
+        std::string text;
+        bool quoted;
+    };
+
+    struct Parameter {
+        std::string name;
+        std::vector<std::string> values;
+        bool used = false;
+    };
+
+    static bool is_number(const std::string& text) {
+        char* end = nullptr;
+        std::strtod(text.c_str(), &end);
+        return !text.empty() && *end == '\0';
+    }
+
+    std::vector<Token> tokenize(const std::string& line) const {
+        std::vector<Token> tokens;
+        size_t i = 0;
+        while (i < line.size()) {
+            if (std::isspace(static_cast<unsigned char>(line[i]))) {
+                i++;
+            } else if (line[i] == '#') {
+                break;
+            } else if (line[i] == '"') {
+                size_t end = line.find('"', i + 1);
+                if (end == std::string::npos)
+                    error("UNTERMINATED STRING");
+                tokens.push_back({line.substr(i + 1, end - i - 1), true});
+                i = end + 1;
+            } else {
+                size_t end = i;
+                while (end < line.size() && !std::isspace(static_cast<unsigned char>(line[end])) && line[end] != '#')
+                    end++;
+                tokens.push_back({line.substr(i, end - i), false});
+                i = end;
+            }
+        }
+        return tokens;
+    }
+
+    std::vector<Parameter> parameters_from(const std::vector<Token>& tokens, size_t first) const {
+        // name value... name value...: a name takes the numbers after it, or else the one token after it
+
+        std::vector<Parameter> parameters;
+        size_t i = first;
+        while (i < tokens.size()) {
+            if (tokens[i].quoted || is_number(tokens[i].text))
+                error("EXPECTED A PARAMETER NAME, GOT \"" + tokens[i].text + "\"");
+
+            Parameter p;
+            p.name = tokens[i++].text;
+            while (i < tokens.size() && !tokens[i].quoted && is_number(tokens[i].text))
+                p.values.push_back(tokens[i++].text);
+            if (p.values.empty()) {
+                if (i >= tokens.size())
+                    error("MISSING VALUE FOR " + p.name);
+                p.values.push_back(tokens[i++].text);
+            }
+            parameters.push_back(p);
+        }
+        return parameters;
+    }
+
+    Parameter* find(const std::string& name) {
+        for (Parameter& p : parameters)
+            if (p.name == name) {
+                p.used = true;
+                return &p;
+            }
+        return nullptr;
+    }
+
+    double number(const std::string& name, double default_value) {
+        Parameter* p = find(name);
+        if (!p)
+            return default_value;
+        if (p->values.size() != 1 || !is_number(p->values[0]))
+            error(name + " TAKES ONE NUMBER");
+        return std::atof(p->values[0].c_str());
+    }
+
+    double required_number(const std::string& name) {
+        if (!find(name))
+            error("MISSING " + name);
+        return number(name, 0.0);
+    }
+
+    Vec3D vector(const std::string& name, const Vec3D& default_value) {
+        Parameter* p = find(name);
+        if (!p)
+            return default_value;
+        if (p->values.size() != 3 || !is_number(p->values[0]))
+            error(name + " TAKES THREE NUMBERS");
+        return Vec3D(std::atof(p->values[0].c_str()), std::atof(p->values[1].c_str()), std::atof(p->values[2].c_str()));
+    }
+
+    Vec3D required_vector(const std::string& name) {
+        if (!find(name))
+            error("MISSING " + name);
+        return vector(name, Vec3D(0, 0, 0));
+    }
+
+    std::string word(const std::string& name, const std::string& default_value) {
+        Parameter* p = find(name);
+        if (!p)
+            return default_value;
+        if (p->values.size() != 1)
+            error(name + " TAKES ONE VALUE");
+        return p->values[0];
+    }
+
+    std::string required_word(const std::string& name) {
+        if (!find(name))
+            error("MISSING " + name);
+        return word(name, "");
+    }
+
+    std::string path(const std::string& name) {
+        // File names are relative to the scene file, unless absolute
+
+        std::string file = required_word(name);
+        bool absolute = !file.empty() && (file[0] == '/' || file[0] == '\\' || (file.size() > 1 && file[1] == ':'));
+        return absolute ? file : directory + file;
+    }
+
+    Matrix4x4 transformation(bool& transformed) {
+        // The transformations of a primitive, composed in the order they are written
+
+        Matrix4x4 object_to_world;
+        transformed = false;
+        for (Parameter& p : parameters) {
+            Matrix4x4 step;
+            if (p.name == "translate" && p.values.size() == 3)
+                step = Matrix4x4::translation(Vec3D(std::atof(p.values[0].c_str()), std::atof(p.values[1].c_str()), std::atof(p.values[2].c_str())));
+            else if (p.name == "scale" && p.values.size() == 3)
+                step = Matrix4x4::scaling(Vec3D(std::atof(p.values[0].c_str()), std::atof(p.values[1].c_str()), std::atof(p.values[2].c_str())));
+            else if (p.name == "scale" && p.values.size() == 1 && is_number(p.values[0]))
+                step = Matrix4x4::scaling(Vec3D(1, 1, 1) * std::atof(p.values[0].c_str()));
+            else if (p.name == "rotate_x" && p.values.size() == 1 && is_number(p.values[0]))
+                step = Matrix4x4::rotation_X(std::atof(p.values[0].c_str()));
+            else if (p.name == "rotate_y" && p.values.size() == 1 && is_number(p.values[0]))
+                step = Matrix4x4::rotation_Y(std::atof(p.values[0].c_str()));
+            else if (p.name == "rotate_z" && p.values.size() == 1 && is_number(p.values[0]))
+                step = Matrix4x4::rotation_Z(std::atof(p.values[0].c_str()));
+            else if (p.name == "translate" || p.name == "scale" || p.name.compare(0, 7, "rotate_") == 0)
+                error("BAD TRANSFORMATION " + p.name);
+            else
+                continue;
+
+            p.used = true;
+            object_to_world = step * object_to_world;
+            transformed = true;
+        }
+        return object_to_world;
+    }
+
+    void check_all_parameters_used() const {
+        for (const Parameter& p : parameters)
+            if (!p.used)
+                error("UNKNOWN PARAMETER " + p.name + " FOR " + keyword);
+    }
+
+    void error(const std::string& message) const {
+        std::cerr << "SCENE FILE " << file_name << " LINE " << line_number << ": " << message << std::endl;
+        exit(0);
+    }
+
+    // Statements
+    // -----------------------------------------------------------------------
+    void set_defaults() {
+        scene_info.aspect_ratio = 1.0;
+        scene_info.image_width = 800;
+        scene_info.max_depth = 10;
+        scene_info.samples_per_pixel = 100;
+        scene_info.lookfrom = Vec3D(0, 0, 0);
+        scene_info.lookat = Vec3D(0, 0, -1);
+        scene_info.vup = Vec3D(0, 1, 0);
+        scene_info.vfov = 40;
+
+        size_t slash = file_name.find_last_of("/\\");
+        std::string stem = file_name.substr(slash == std::string::npos ? 0 : slash + 1);
+        scene_info.output_image_name = stem.substr(0, stem.find_last_of('.'));
+    }
+
+    void parse_statement(const std::vector<Token>& tokens) {
+        keyword = tokens[0].text;
+
+        if (keyword == "texture" || keyword == "material") {
+            if (tokens.size() < 3)
+                error(keyword + " NEEDS A NAME AND A TYPE");
+            std::string name = tokens[1].text;
+            std::string type = tokens[2].text;
+            parameters = parameters_from(tokens, 3);
+            if (keyword == "texture")
+                textures[name] = make_texture(type);
+            else
+                parse_material(name, type);
+        } else {
+            parameters = parameters_from(tokens, 1);
+            if (keyword == "image") parse_image();
+            else if (keyword == "render") parse_render();
+            else if (keyword == "output") scene_info.output_image_name = required_word("name");
+            else if (keyword == "camera") parse_camera();
+            else if (keyword == "accelerator") parse_accelerator();
+            else if (keyword == "lights") parse_lights();
+            else if (keyword == "sphere" || keyword == "moving_sphere" || keyword == "rectangle" || keyword == "box" ||
+                     keyword == "triangle" || keyword == "mesh") parse_primitive();
+            else error("UNKNOWN KEYWORD " + keyword);
+        }
+
+        check_all_parameters_used();
+    }
+
+    void parse_image() {
+        scene_info.image_width = static_cast<int>(number("width", scene_info.image_width));
+        scene_info.aspect_ratio = number("aspect_ratio", scene_info.aspect_ratio);
+        if (scene_info.image_width <= 0 || scene_info.aspect_ratio <= 0)
+            error("IMAGE WIDTH AND ASPECT RATIO MUST BE POSITIVE");
+    }
+
+    void parse_render() {
+        scene_info.samples_per_pixel = static_cast<int>(number("samples_per_pixel", scene_info.samples_per_pixel));
+        scene_info.max_depth = static_cast<int>(number("max_depth", scene_info.max_depth));
+        scene_info.number_of_threads_used = static_cast<int>(number("threads", scene_info.number_of_threads_used));
+        scene_info.ray_cones = number("ray_cones", scene_info.ray_cones ? 1 : 0) != 0;
+        sampler_name = word("sampler", sampler_name);
+        sampler_seed = static_cast<uint64_t>(number("seed", static_cast<double>(sampler_seed)));
+    }
+
+    void parse_camera() {
+        scene_info.lookfrom = vector("lookfrom", scene_info.lookfrom);
+        scene_info.lookat = vector("lookat", scene_info.lookat);
+        scene_info.vup = vector("vup", scene_info.vup);
+        scene_info.vfov = number("vfov", scene_info.vfov);
+        aperture = number("aperture", aperture);
+        focus_distance = number("focus_distance", focus_distance);
+        if (find("focus_point"))
+            focus_distance = (vector("focus_point", Vec3D(0, 0, 0)) - scene_info.lookfrom).length();
+
+        Parameter* shutter = find("shutter");
+        if (shutter) {
+            if (shutter->values.size() != 2 || !is_number(shutter->values[0]))
+                error("shutter TAKES TWO NUMBERS: OPEN AND CLOSE TIMES");
+            shutter_open = std::atof(shutter->values[0].c_str());
+            shutter_close = std::atof(shutter->values[1].c_str());
+        }
+    }
+
+    void parse_accelerator() {
+        if (!parse_BVH_builder(required_word("builder"), builder) || builder == SCENE_DEFAULT_BVH)
+            error("UNKNOWN BVH BUILDER");
+    }
+
+    void parse_lights() {
+        std::string sampling = required_word("sampling");
+        if (sampling == "group") light_sampler = nullptr;
+        else if (sampling == "power") light_sampler = std::make_shared<Light_Sampler>(POWER_SAMPLING);
+        else if (sampling == "light_bvh") light_sampler = std::make_shared<Light_Sampler>(LIGHT_BVH_SAMPLING);
+        else error("UNKNOWN LIGHT SAMPLING " + sampling);
+    }
+
+    std::shared_ptr<Texture> texture_named(const std::string& name) const {
+        auto t = textures.find(name);
+        if (t == textures.end())
+            error("UNDEFINED TEXTURE " + name);
+        return t->second;
+    }
+
+    std::shared_ptr<Texture> make_texture(const std::string& type) {
+        if (type == "constant")
+            return std::make_shared<Constant_Color>(required_vector("color"));
+        if (type == "stripes") {
+            std::shared_ptr<Texture> first = texture_named(required_word("first"));
+            std::shared_ptr<Texture> second = texture_named(required_word("second"));
+            if (!find("width"))
+                return std::make_shared<Stripe_Texture>(first, second);
+            double width = number("width", 1.0);
+            if (width <= 0)
+                error("STRIPES WIDTH MUST BE POSITIVE");
+            return std::make_shared<Stripe_Texture_Controllable_Width>(first, second, width, number("interpolate", 0) != 0);
+        }
+        if (type == "image")
+            return std::make_shared<Image_Texture>(path("file"), static_cast<int>(number("raw_width", 0)),
+                                                   static_cast<int>(number("raw_height", 0)));
+        if (type == "noise")
+            return std::make_shared<Noise_Texture>();
+        error("UNKNOWN TEXTURE TYPE " + type);
+        return nullptr;
+    }
+
+    void parse_material(const std::string& name, const std::string& type) {
+        std::shared_ptr<Material> material;
+        Color color = vector("color", Color(0.73, 0.73, 0.73));
+
+        if (type == "diffuse") {
+            if (find("texture"))
+                material = std::make_shared<Diffuse_With_Texture>(texture_named(word("texture", "")));
+            else
+                material = std::make_shared<Diffuse>(color);
+        }
+        else if (type == "uniform_diffuse") material = std::make_shared<Uniform_Hemispherical_Diffuse>(color);
+        else if (type == "disney_diffuse") material = std::make_shared<Disney_Diffuse>(color, number("roughness", 0.5));
+        else if (type == "specular") material = std::make_shared<Specular>(color, number("fuzz", 0.0), number("index_of_refraction", 1.0));
+        else if (type == "phong") material = std::make_shared<Phong>(color, number("specular", 0.8), number("shininess", 2.5));
+        else if (type == "light") {
+            material = std::make_shared<Diffuse_Light>(color);
+            emission[name] = color;
+        }
+        else error("UNKNOWN MATERIAL TYPE " + type);
+
+        materials[name] = material;
+    }
+
+    std::string material_name() {
+        std::string name = required_word("material");
+        if (materials.find(name) == materials.end())
+            error("UNDEFINED MATERIAL " + name);
+        return name;
+    }
+
+    void parse_primitive() {
+        std::string material = material_name();
+        std::shared_ptr<Material> m = materials[material];
+        bool transformed;
+        Matrix4x4 object_to_world = transformation(transformed);
+
+        if (keyword == "mesh") {
+            std::vector<Triangle> faces;
+            if (!load_OBJ_mesh(path("file"), m, object_to_world, faces))
+                error("COULD NOT LOAD MESH");
+            std::shared_ptr<Memory_Arena> mesh_arena = std::make_shared<Memory_Arena>();       // see add_mesh_to_world()
+            for (const Triangle& triangle : faces)
+                add_primitive(mesh_arena->make_shared<Triangle>(triangle), material);
+            return;
+        }
+        if (keyword == "triangle") {
+            add_primitive(std::make_shared<Triangle>(object_to_world.transform_point(required_vector("v0")),
+                                                     object_to_world.transform_point(required_vector("v1")),
+                                                     object_to_world.transform_point(required_vector("v2")), m), material);
+            return;
+        }
+
+        std::shared_ptr<Primitive> primitive;
+        if (keyword == "sphere") {
+            primitive = std::make_shared<Sphere>(required_vector("center"), required_number("radius"), m);
+        } else if (keyword == "moving_sphere") {
+            primitive = std::make_shared<Moving_Sphere>(required_vector("center0"), required_vector("center1"),
+                                                        number("time0", shutter_open), number("time1", shutter_close),
+                                                        required_number("radius"), m);
+        } else if (keyword == "box") {
+            primitive = std::make_shared<Box>(required_vector("min"), required_vector("max"), m);
+        } else {
+            std::string plane = required_word("plane");
+            point3D min_point = required_vector("min");
+            point3D max_point = required_vector("max");
+            if (plane == "xy") primitive = std::make_shared<XY_Rectangle>(min_point, max_point, m);
+            else if (plane == "xz") primitive = std::make_shared<XZ_Rectangle>(min_point, max_point, m);
+            else if (plane == "yz") primitive = std::make_shared<YZ_Rectangle>(min_point, max_point, m);
+            else error("RECTANGLE PLANE MUST BE xy, xz OR yz");
+        }
+
+        if (transformed) {
+            if (emission.count(material))
+                std::cerr << "SCENE FILE " << file_name << " LINE " << line_number
+                          << ": A TRANSFORMED LIGHT IS NOT IMPORTANCE SAMPLED" << std::endl;
+            scene_info.world.add_primitive_to_list(std::make_shared<Transform>(primitive, object_to_world));
+            return;
+        }
+        add_primitive(primitive, material);
+    }
+
+    void add_primitive(const std::shared_ptr<Primitive>& primitive, const std::string& material) {
+        scene_info.world.add_primitive_to_list(primitive);
+
+        // The lights are only put together in finish(), since the lights statement may come after them
+        auto e = emission.find(material);
+        if (e != emission.end())
+            emitters.push_back({primitive, e->second});
+    }
+
+    std::shared_ptr<Sampler> make_sampler() const {
+        if (sampler_name == "independent") return nullptr;
+        if (sampler_name == "halton") return std::make_shared<Halton_Sampler>(sampler_seed);
+        if (sampler_name == "sobol") return std::make_shared<Sobol_Sampler>(sampler_seed);
+        if (sampler_name == "blue_noise") return std::make_shared<Blue_Noise_Sampler>(sampler_seed);
+        if (sampler_name == "stratified") {
+            int strata = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(scene_info.samples_per_pixel))));
+            return std::make_shared<Stratified_Sampler>(strata, strata, true, sampler_seed);
+        }
+        error("UNKNOWN SAMPLER " + sampler_name);
+        return nullptr;
+    }
+
+    Scene_Information finish() {
+        // Settings that depend on several statements, then the BVH and the lights
+
+        scene_info.image_height = static_cast<int>(scene_info.image_width / scene_info.aspect_ratio);
+        scene_info.sampler = make_sampler();
+        scene_info.camera = Camera(scene_info.lookfrom, scene_info.lookat, scene_info.vup, scene_info.vfov, scene_info.aspect_ratio,
+                                   aperture, focus_distance, shutter_open, shutter_close);
+
+        if (scene_info.world.primitives_list.empty()) {
+            std::cerr << "SCENE FILE " << file_name << " HAS NO PRIMITIVES!" << std::endl;
+            exit(0);
+        }
+
+        auto start = omp_get_wtime();           // measure time
+        scene_info.world = build_BVH(scene_info.world, builder, shutter_open, shutter_close);
+        auto end = omp_get_wtime();
+        std::cout << "BVH Building took: " <<  end - start << std::endl;
+        scene_info.BVH_build_time = end - start;
+
+        if (emitters.empty())
+            std::cerr << "SCENE FILE " << file_name << " HAS NO LIGHTS TO IMPORTANCE SAMPLE" << std::endl;
+        else if (light_sampler) {
+            for (const auto& emitter : emitters)
+                light_sampler->add_light(emitter.first, emitter.second);
+            light_sampler->build();
+            scene_info.lights = Primitives_Group(light_sampler);
+        } else {
+            for (const auto& emitter : emitters)
+                scene_info.lights.add_primitive_to_list(emitter.first);
+        }
+
+        return scene_info;
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    std::string file_name;
+    std::string directory;                      // prefix for the relative file names in the scene
+    int line_number = 0;
+    std::string keyword;                        // of the statement being parsed
+    std::vector<Parameter> parameters;          // ...and its parameters
+
+    Scene_Information scene_info;
+    std::map<std::string, std::shared_ptr<Texture>> textures;
+    std::map<std::string, std::shared_ptr<Material>> materials;
+    std::map<std::string, Color> emission;      // of the light materials
+
+    double aperture = 0.0;
+    double focus_distance = 1.0;
+    double shutter_open = 0.0;
+    double shutter_close = 0.0;
+    std::string sampler_name = "independent";
+    uint64_t sampler_seed = 0;
+    BVH_BUILDER builder = BVH_FLAT;
+    std::shared_ptr<Light_Sampler> light_sampler;    // nullptr: the lights are a Primitives_Group
+    std::vector<std::pair<std::shared_ptr<Primitive>, Color>> emitters;     // light primitives and their emission
+};
+
+inline Scene_Information load_scene_file(const std::string& file_name) {
+    return Scene_File_Parser(file_name).parse();
+}
+
+#endif //CUDA_RAY_TRACER_SCENE_FILE_H
@@ -0,0 +1,67 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_SCENE_REGISTRY_H
+#define CUDA_RAY_TRACER_SCENE_REGISTRY_H
+
+#include "Scenes.h"
+#include "Scene_File.h"
+#include <string>
+
+// The scenes of Scenes.h by name, for the command-line programs (the benchmark and the tools) that pick a
+// scene at run time. Every process that builds a scene from its name gets the same Scene_Information.
+// A name ending in ".scene" is a scene file instead (see Scene_File.h).
+// -----------------------------------------------------------------------
+struct Scene_Entry {
+    const char* name;
+    Scene_Information (*build)();
+};
+
+static const Scene_Entry scenes[] = {
+        {"one_weekend", one_weekend_scene},
+        {"dragon", enter_the_dragon},
+        {"Lucy_with_light", Lucy_with_light},
+        {"Lucy", enter_Lucy},
+        {"Lucy_with_a_mirror", Lucy_with_a_mirror},
+        {"rabbit_teapot", a_rabbit_and_a_teapot_inside_a_Cornell_box},
+        {"rabbit_teapot_no_importance_sampling", a_rabbit_and_a_teapot_inside_a_Cornell_box_without_importance_sampling},
+        {"full_Cornell", full_Cornell_box},
+        {"texture_Cornell", texture_Cornell_box},
+        {"diffuse_models", different_diffuse_models_scene},
+        {"motion_blur", motion_blur_and_depth_of_field_scene},
+        {"many_lights", many_lights_Cornell_box}
+};
+
+template <typename Entry, size_t N>
+const Entry* find_entry(const Entry (&entries)[N], const std::string& name) {
+    for (size_t i = 0; i < N; i++)
+        if (name == entries[i].name)
+            return &entries[i];
+    return nullptr;
+}
+
+template <typename Entry, size_t N>
+std::string list_entries(const Entry (&entries)[N]) {
+    std::string list;
+    for (size_t i = 0; i < N; i++)
+        list += (i ? ", " : "") + std::string(entries[i].name);
+    return list;
+}
+
+inline bool is_scene_file(const std::string& name) {
+    const std::string extension = ".scene";
+    return name.size() > extension.size() && name.compare(name.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+inline bool scene_exists(const std::string& name) {
+    return is_scene_file(name) ? std::ifstream(name).good() : find_entry(scenes, name) != nullptr;
+}
+
+inline Scene_Information build_scene(const std::string& name) {
+    // The registered scene with that name, or the scene file
+
+    return is_scene_file(name) ? load_scene_file(name) : find_entry(scenes, name)->build();
+}
+
+#endif //CUDA_RAY_TRACER_SCENE_REGISTRY_H
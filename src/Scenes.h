@@ -8,6 +8,7 @@
 #include "Utilities.h"
 #include "Primitives/Primitives_Group.h"
 #include "Primitives/Sphere.h"
+#include "Primitives/Moving_Sphere.h"
 #include "Materials/Diffuse.h"
 #include "Materials/Specular.h"
 #include "Accelerators/BVH.h"
@@ -15,6 +16,7 @@
 #include "Accelerators/BVH_Centroid_Coordinate.h"
 #include "Accelerators/BVH_Parallel.h"
 #include "Mathematics/Transformations/Translate.h"
+#include "Mathematics/Transformations/Transform.h"
 #include "Materials/Phong.h"
 #include "Materials/Diffuse_Light.h"
 #include "Mathematics/Transformations/Rotate_Y.h"
@@ -28,8 +30,19 @@
 #include "Materials/Uniform_Hemispherical_Diffuse.h"
 #include "Primitives/Triangle.h"
 #include "Accelerators/BVH_Fast.h"
+#include "Accelerators/Light_Sampler.h"
+#include "Accelerators/BVH_Builders.h"
 #include "Textures/Texture.h"
+#include "Textures/Image_Texture.h"
 #include "Cameras/Camera.h"
+#include "Cameras/Orthographic_Camera.h"
+#include "Rendering/Denoiser.h"
+#include "Rendering/Checkpoint.h"
+#include "Samplers/Independent_Sampler.h"
+#include "Samplers/Stratified_Sampler.h"
+#include "Samplers/Halton_Sampler.h"
+#include "Samplers/Sobol_Sampler.h"
+#include "Samplers/Blue_Noise_Sampler.h"
 #include "Materials/Diffuse_With_Texture.h"
 #include "Materials/Disney_Diffuse.h"
 
@@ -44,8 +57,10 @@ struct Scene_Information {
     // -------------------------------------------------------------------------------
     int max_depth;
     int samples_per_pixel;
+    int first_sample = 0;                       // sample index to start at; see parallel_checkpointed_radiance_mixture_renderer()
     Primitives_Group world;
     Primitives_Group lights;
+    std::shared_ptr<Sampler> sampler;           // sample generator; nullptr draws independent random numbers
 
     // Camera settings
     // -------------------------------------------------------------------------------
@@ -56,6 +71,12 @@ struct Scene_Information {
 
     Camera camera;
     Orthographic_Camera orthographic_camera;
+    bool ray_cones = true;                      // renderers start a pixel-wide ray cone for texture filtering (see Ray)
+
+    // Post-processing (see Rendering/Denoiser.h)
+    // -------------------------------------------------------------------------------
+    Denoiser_Settings denoiser;
+    Checkpoint_Settings checkpoint;             // used by parallel_checkpointed_radiance_mixture_renderer()
 
     // .ppm image file name
     // -------------------------------------------------------------------------------
@@ -63,10 +84,12 @@ struct Scene_Information {
 
     // Statistics
     // -------------------------------------------------------------------------------
-    double BVH_build_time;
-    double render_time;
-    int number_of_ray_intersection_tests;
-    int number_of_threads_used;
+    double BVH_build_time = 0.0;
+    double render_time = 0.0;                   // seconds spent in the render loop, set by the renderers
+    long long rays_traced = 0;                  // ray counter (see Render_Statistics.h) right after the render loop,
+                                                // so that denoising and AOV rays are not counted
+    long long number_of_ray_intersection_tests = 0;
+    int number_of_threads_used = 16;            // OpenMP threads used by the parallel renderers
 };
 
 Scene_Information one_weekend_scene() {
@@ -138,7 +161,7 @@ Scene_Information one_weekend_scene() {
     // Construct BVH
     // -------------------------------------------------------------------------------
     double start = omp_get_wtime();
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Fast>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
     double end = omp_get_wtime();
     scene_info.BVH_build_time = end - start;
 
@@ -212,15 +235,13 @@ Scene_Information enter_the_dragon() {
     load_model("C:\\Users\\Rami\\Desktop\\dragon.obj" , bunny_vertices, bunny_faces, gold_phong, bunny_D, bunny_scale_factor, angle_of_rotation_X, angle_of_rotation_Y, angle_of_rotation_Z); // "C:\\Users\\Rami\\Desktop\\Lucy.obj"
 
     // Add the dragon to the world
-    for (const auto& triangle : bunny_faces) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, bunny_faces);
 
     auto start = omp_get_wtime();           // measure time
 
     // Construct BVH
     // -------------------------------------------------------------------------------
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Fast>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
 
     auto end = omp_get_wtime();
     std::cout << "BVH Building took: " <<  end - start << std::endl;
@@ -300,13 +321,11 @@ Scene_Information Lucy_with_light() {
     load_model("C:\\Users\\Rami\\Desktop\\Lucy.obj", lucy_vertices, lucy_faces, lucy_mat, bunny_D, bunny_scale_factor, angle_of_rotation_X, angle_of_rotation_Y, angle_of_rotation_Z);
 
     // Add Lucy faces to the world
-    for (const auto& triangle : lucy_faces) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, lucy_faces);
 
     // Construct BVH
     // -------------------------------------------------------------------------------
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Fast>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
 
     // Lights
     // -------------------------------------------------------------------------------
@@ -387,9 +406,7 @@ Scene_Information enter_Lucy() {
     load_model("C:\\Users\\Rami\\Desktop\\Lucy.obj", lucy_vertices, lucy_faces, lucy_mat, lucy_D, lucy_scale_factor, angle_of_rotation_X, angle_of_rotation_Y, angle_of_rotation_Z);
 
     // Add Lucy's faces to the world
-    for (const auto& triangle : lucy_faces) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, lucy_faces);
 
     /* Utah Teapot */
     /******************/
@@ -414,14 +431,12 @@ Scene_Information enter_Lucy() {
     load_model("C:\\Users\\Rami\\Downloads\\teapot.obj", teapot_vertices, teapot_triangles, pink, teapot_D, teapot_scale_factor, teapot_angle_of_rotation);
 
     // Add the teapot's faces to the world
-    for (const auto& triangle : teapot_triangles) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, teapot_triangles);
 
     auto start = omp_get_wtime();           // measure time
     // Construct BVH
     // -------------------------------------------------------------------------------
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Fast>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
 
     auto end = omp_get_wtime();
     std::cout << "BVH Building took: " <<  end - start << std::endl;
@@ -486,8 +501,7 @@ Scene_Information Lucy_with_a_mirror() {
 
     // Translation/Rotation
     // -------------------------------------------------------------------------------
-    box1 = std::make_shared<Rotate_Y>(box1, 27);
-    box1 = std::make_shared<Translate>(box1, Vec3D(265,0,295));
+    box1 = std::make_shared<Transform>(box1, Matrix4x4::translation(Vec3D(265,0,295)) * Matrix4x4::rotation_Y(27));
     scene_info.world.add_primitive_to_list(box1);
 
     // Add Meshes to the scene
@@ -513,13 +527,11 @@ Scene_Information Lucy_with_a_mirror() {
     load_model("C:\\Users\\Rami\\Desktop\\Lucy.obj", lucy_vertices, lucy_faces, lucy_mat, bunny_D, bunny_scale_factor, angle_of_rotation_X, angle_of_rotation_Y, angle_of_rotation_Z);
 
     // Add Lucy's faces to the world
-    for (const auto& triangle : lucy_faces) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, lucy_faces);
 
     // Construct BVH
     // -------------------------------------------------------------------------------
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Fast>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
 
     // Lights
     // -------------------------------------------------------------------------------
@@ -580,15 +592,13 @@ Scene_Information a_rabbit_and_a_teapot_inside_a_Cornell_box() {
 
     // Translation/Rotation
     // -------------------------------------------------------------------------------
-    box1 = std::make_shared<Rotate_Y>(box1, 15);
-    box1 = std::make_shared<Translate>(box1, Vec3D(265,0,295));
+    box1 = std::make_shared<Transform>(box1, Matrix4x4::translation(Vec3D(265,0,295)) * Matrix4x4::rotation_Y(15));
     scene_info.world.add_primitive_to_list(box1);
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Fast>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
 
-    box2 = std::make_shared<Rotate_Y>(box2, -18);
-    box2 = std::make_shared<Translate>(box2, Vec3D(90,0,65));
+    box2 = std::make_shared<Transform>(box2, Matrix4x4::translation(Vec3D(90,0,65)) * Matrix4x4::rotation_Y(-18));
     scene_info.world.add_primitive_to_list(box2);
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Fast>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
 
     // Add Meshes to the scene
     // -------------------------------------------------------------------------------
@@ -615,9 +625,7 @@ Scene_Information a_rabbit_and_a_teapot_inside_a_Cornell_box() {
     load_model("C:\\Users\\Rami\\Desktop\\Folders\\Computer Graphics\\3D Models\\Simple_Bunny.obj.txt", bunny_vertices, bunny_faces, bunny_material, bunny_D, bunny_scale_factor, angle_of_rotation_1);
 
     // Add the bunny faces to the world
-    for (const auto& triangle : bunny_faces) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, bunny_faces);
 
     /* Utah Teapot */
     /******************/
@@ -642,14 +650,12 @@ Scene_Information a_rabbit_and_a_teapot_inside_a_Cornell_box() {
     load_model("C:\\Users\\Rami\\Downloads\\teapot.obj", teapot_vertices, teapot_triangles, teapot_royal_blue_phong, D, scale_factor, angle_of_rotation);
 
     // Add the teapot's faces to the world
-    for (const auto& triangle : teapot_triangles) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, teapot_triangles);
 
     auto start = omp_get_wtime();           // measure time
     // Construct BVH
     // -------------------------------------------------------------------------------
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Fast>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
     // scene_info.world = Primitives_Group(std::make_shared<BVH>(scene_info.world));
     // scene_info.world = Primitives_Group(std::make_shared<BVH_Max_Coordinate>(scene_info.world));
     // scene_info.world = Primitives_Group(std::make_shared<BVH_Centroid_Coordinate>(scene_info.world));
@@ -717,12 +723,10 @@ Scene_Information a_rabbit_and_a_teapot_inside_a_Cornell_box_without_importance_
 
     // Translation/Rotation
     // -------------------------------------------------------------------------------
-    box1 = std::make_shared<Rotate_Y>(box1, 15);
-    box1 = std::make_shared<Translate>(box1, Vec3D(265,0,295));
+    box1 = std::make_shared<Transform>(box1, Matrix4x4::translation(Vec3D(265,0,295)) * Matrix4x4::rotation_Y(15));
     scene_info.world.add_primitive_to_list(box1);
 
-    box2 = std::make_shared<Rotate_Y>(box2, -18);
-    box2 = std::make_shared<Translate>(box2, Vec3D(90,0,65));
+    box2 = std::make_shared<Transform>(box2, Matrix4x4::translation(Vec3D(90,0,65)) * Matrix4x4::rotation_Y(-18));
     scene_info.world.add_primitive_to_list(box2);
 
     // Add Meshes to the scene
@@ -751,9 +755,7 @@ Scene_Information a_rabbit_and_a_teapot_inside_a_Cornell_box_without_importance_
     load_model("C:\\Users\\Rami\\Desktop\\Folders\\Computer Graphics\\3D Models\\Simple_Bunny.obj.txt", bunny_vertices, bunny_faces, bunny_material, bunny_D, bunny_scale_factor, bunny_angle_of_rotation);
 
     // Add bunny's triangles to the scene's "world"
-    for (const auto& triangle : bunny_faces) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, bunny_faces);
 
     /* Utah Teapot */
     /******************/
@@ -778,13 +780,11 @@ Scene_Information a_rabbit_and_a_teapot_inside_a_Cornell_box_without_importance_
     load_model("C:\\Users\\Rami\\Downloads\\teapot.obj", teapot_vertices, teapot_faces, royal_blue_phong, D, scale_factor, angle_of_rotation);
 
     // Add triangles to the scene's "world"
-    for (const auto& triangle : teapot_faces) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, teapot_faces);
 
     // Construct BVH
     // -------------------------------------------------------------------------------
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Fast>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
 
     // Lights
     // -------------------------------------------------------------------------------
@@ -847,10 +847,9 @@ Scene_Information full_Cornell_box() {
 
     // Translation/Rotation
     // -------------------------------------------------------------------------------
-    box = std::make_shared<Rotate_Y>(box, -18);
-    box = std::make_shared<Translate>(box, Vec3D(90, 0, 65));
+    box = std::make_shared<Transform>(box, Matrix4x4::translation(Vec3D(90, 0, 65)) * Matrix4x4::rotation_Y(-18));
     scene_info.world.add_primitive_to_list(box);
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Fast>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
 
     // Add Meshes to the scene
     // -------------------------------------------------------------------------------
@@ -876,9 +875,7 @@ Scene_Information full_Cornell_box() {
     load_model("C:\\Users\\Rami\\Desktop\\Erato.obj" , erato_vertices, erato_faces, erato_material, erato_D, erato_scale_factor, xa, ya, xc); // "C:\\Users\\Rami\\Desktop\\Lucy.obj"
 
     // Add the bunny faces to the world
-    for (const auto& triangle : erato_faces) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, erato_faces);
 
     /* Stanford Bunny */
     /******************/
@@ -900,9 +897,7 @@ Scene_Information full_Cornell_box() {
     // Load the Stanford Bunny from the .obj file
     load_model("C:\\Users\\Rami\\Desktop\\Folders\\Computer Graphics\\3D Models\\Simple_Bunny.obj.txt", bunny_vertices, bunny_faces, pink, bunny_D, bunny_scale_factor, angle_of_rotation_1);
     // Add the bunny faces to the world
-    for (const auto& triangle : bunny_faces) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, bunny_faces);
 
     /* Utah Teapot */
     /******************/
@@ -927,15 +922,13 @@ Scene_Information full_Cornell_box() {
     load_model("C:\\Users\\Rami\\Downloads\\teapot.obj", teapot_vertices, teapot_triangles, teapot_royal_blue_phong, D, scale_factor, angle_of_rotation);
 
     // Add the teapot's faces to the world
-    for (const auto& triangle : teapot_triangles) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, teapot_triangles);
 
     auto start = omp_get_wtime();           // measure time
     // Construct BVH
     // -------------------------------------------------------------------------------
     // scene_info.world = Primitives_Group(std::make_shared<BVH_Fast>(scene_info.world));
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Parallel>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
 
     auto end = omp_get_wtime();
     std::cout << "BVH Building took: " <<  end - start << std::endl;
@@ -1025,14 +1018,12 @@ Scene_Information texture_Cornell_box() {
     load_model("C:\\Users\\Rami\\Desktop\\dragon.obj" , bunny_vertices, bunny_faces, diffuse_texture_2, bunny_D, bunny_scale_factor, angle_of_rotation_X, angle_of_rotation_Y, angle_of_rotation_Z); // "C:\\Users\\Rami\\Desktop\\Lucy.obj"
 
     // Add the dragon to the world
-    for (const auto& triangle : bunny_faces) {
-        scene_info.world.add_primitive_to_list(std::make_shared<Triangle>(triangle));
-    }
+    add_mesh_to_world(scene_info.world, bunny_faces);
 
     auto start = omp_get_wtime();           // measure time
     // Construct BVH
     // -------------------------------------------------------------------------------
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Parallel>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
 
     auto end = omp_get_wtime();
     std::cout << "BVH Building took: " <<  end - start << std::endl;
@@ -1103,7 +1094,7 @@ Scene_Information different_diffuse_models_scene() {
     auto start = omp_get_wtime();           // measure time
     // Construct BVH
     // -------------------------------------------------------------------------------
-    scene_info.world = Primitives_Group(std::make_shared<BVH_Parallel>(scene_info.world));
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
 
     auto end = omp_get_wtime();
     std::cout << "BVH Building took: " <<  end - start << std::endl;
@@ -1117,4 +1108,168 @@ Scene_Information different_diffuse_models_scene() {
     return scene_info;
 }
 
+Scene_Information motion_blur_and_depth_of_field_scene() {
+    Scene_Information scene_info;
+
+    // Image settings
+    // -------------------------------------------------------------------------------
+    scene_info.aspect_ratio = 1.0;
+    scene_info.image_width = 800;
+    scene_info.image_height = static_cast<int>(scene_info.image_width / scene_info.aspect_ratio);
+
+    // Rendering settings
+    // -------------------------------------------------------------------------------
+    scene_info.max_depth = 30;
+    scene_info.samples_per_pixel = 1024;                        // a power of two, for the Sobol sampler
+    scene_info.sampler = std::make_shared<Sobol_Sampler>();
+
+    // Camera settings
+    // -------------------------------------------------------------------------------
+    scene_info.lookfrom = Vec3D(278, 278, -800);
+    scene_info.lookat = Vec3D(278, 278, 0);
+    scene_info.vup = Vec3D(0, 1, 0);
+    scene_info.vfov = 40;
+    scene_info.output_image_name = "Motion Blur and Depth of Field";
+
+    // The lens is focused on the middle sphere; the shutter stays open over [0,1]
+    double aperture = 20.0;
+    double focus_distance = (point3D(285, 60, 190) - scene_info.lookfrom).length();
+    double shutter_open = 0.0;
+    double shutter_close = 1.0;
+
+    scene_info.camera = Camera(scene_info.lookfrom, scene_info.lookat, scene_info.vup, scene_info.vfov, scene_info.aspect_ratio,
+                               aperture, focus_distance, shutter_open, shutter_close);
+
+    // Materials
+    // -------------------------------------------------------------------------------
+    // Walls materials
+    std::shared_ptr<Diffuse> red = std::make_shared<Diffuse>(Color(0.65, 0.05, 0.05));
+    std::shared_ptr<Diffuse> white = std::make_shared<Diffuse>(Color(0.73, 0.73, 0.73));
+    std::shared_ptr<Diffuse> green = std::make_shared<Diffuse>(Color(0.12, 0.45, 0.15));
+
+    // Spheres materials
+    std::shared_ptr<Diffuse> sphere_blue_diffuse = std::make_shared<Diffuse>(Color(0.70, 0.80, 1.00));
+    std::shared_ptr<Diffuse> sphere_orange_diffuse = std::make_shared<Diffuse>(Color(1.00, 0.50, 0.00));
+
+    // Light material
+    std::shared_ptr<Diffuse_Light> light = std::make_shared<Diffuse_Light>(Color(30,30,30));
+
+    // Primitives
+    // -------------------------------------------------------------------------------
+    // Add walls and light in the ceiling
+    scene_info.world.add_primitive_to_list(std::make_shared<YZ_Rectangle>(point3D(555, 0, 0), point3D(555, 555, 555), green));
+    scene_info.world.add_primitive_to_list(std::make_shared<YZ_Rectangle>(point3D(0,0,0), point3D(0, 555, 555), red));
+    scene_info.world.add_primitive_to_list(std::make_shared<XY_Rectangle>(point3D(0, 0, 555), point3D(555, 555, 555), white));
+    scene_info.world.add_primitive_to_list(std::make_shared<XZ_Rectangle>(point3D(213, 554, 227), point3D(343,554,332), light));
+    scene_info.world.add_primitive_to_list(std::make_shared<XZ_Rectangle>(point3D(0, 0, 0), point3D(555,0,555), white));
+    scene_info.world.add_primitive_to_list(std::make_shared<XZ_Rectangle>(point3D(0, 555, 0), point3D(555,555,555), white));
+
+    // A sphere in focus, one in front of it (out of focus) and one bouncing up while the shutter is open
+    scene_info.world.add_primitive_to_list(std::make_shared<Sphere>(point3D(285,60,190), 60, sphere_blue_diffuse));
+    scene_info.world.add_primitive_to_list(std::make_shared<Sphere>(point3D(430,60,-100), 60, sphere_blue_diffuse));
+    scene_info.world.add_primitive_to_list(std::make_shared<Moving_Sphere>(point3D(140,60,190), point3D(140,160,190),
+                                                                           shutter_open, shutter_close, 60, sphere_orange_diffuse));
+
+    auto start = omp_get_wtime();           // measure time
+    // Construct BVH
+    // -------------------------------------------------------------------------------
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT, shutter_open, shutter_close);
+
+    auto end = omp_get_wtime();
+    std::cout << "BVH Building took: " <<  end - start << std::endl;
+    scene_info.BVH_build_time = end - start;
+
+    // Lights
+    // -------------------------------------------------------------------------------
+    auto m = std::shared_ptr<Material>();
+    scene_info.lights.add_primitive_to_list(std::make_shared<XZ_Rectangle>(point3D(213, 554, 227), point3D(343,554,332), m));
+
+    return scene_info;
+}
+
+Scene_Information many_lights_Cornell_box() {
+    Scene_Information scene_info;
+
+    // Image settings
+    // -------------------------------------------------------------------------------
+    scene_info.aspect_ratio = 1.0;
+    scene_info.image_width = 800;
+    scene_info.image_height = static_cast<int>(scene_info.image_width / scene_info.aspect_ratio);
+
+    // Rendering settings
+    // -------------------------------------------------------------------------------
+    scene_info.max_depth = 30;
+    scene_info.samples_per_pixel = 256;
+
+    // Camera settings
+    // -------------------------------------------------------------------------------
+    scene_info.lookfrom = Vec3D(278, 278, -800);
+    scene_info.lookat = Vec3D(278, 278, 0);
+    scene_info.vup = Vec3D(0, 1, 0);
+    scene_info.vfov = 40;
+    scene_info.output_image_name = "Many Lights Cornell Box";
+
+    scene_info.camera = Camera(scene_info.lookfrom, scene_info.lookat, scene_info.vup, scene_info.vfov, scene_info.aspect_ratio);
+
+    // Materials
+    // -------------------------------------------------------------------------------
+    std::shared_ptr<Diffuse> red = std::make_shared<Diffuse>(Color(0.65, 0.05, 0.05));
+    std::shared_ptr<Diffuse> white = std::make_shared<Diffuse>(Color(0.73, 0.73, 0.73));
+    std::shared_ptr<Diffuse> green = std::make_shared<Diffuse>(Color(0.12, 0.45, 0.15));
+    std::shared_ptr<Diffuse> sphere_blue_diffuse = std::make_shared<Diffuse>(Color(0.70, 0.80, 1.00));
+
+    // Primitives
+    // -------------------------------------------------------------------------------
+    // Add walls
+    scene_info.world.add_primitive_to_list(std::make_shared<YZ_Rectangle>(point3D(555, 0, 0), point3D(555, 555, 555), green));
+    scene_info.world.add_primitive_to_list(std::make_shared<YZ_Rectangle>(point3D(0,0,0), point3D(0, 555, 555), red));
+    scene_info.world.add_primitive_to_list(std::make_shared<XY_Rectangle>(point3D(0, 0, 555), point3D(555, 555, 555), white));
+    scene_info.world.add_primitive_to_list(std::make_shared<XZ_Rectangle>(point3D(0, 0, 0), point3D(555,0,555), white));
+    scene_info.world.add_primitive_to_list(std::make_shared<XZ_Rectangle>(point3D(0, 555, 0), point3D(555,555,555), white));
+
+    scene_info.world.add_primitive_to_list(std::make_shared<Sphere>(point3D(190,90,190), 90, sphere_blue_diffuse));
+    scene_info.world.add_primitive_to_list(std::make_shared<Sphere>(point3D(400,60,300), 60, white));
+
+    // Add a 16x16 grid of emissive quads (512 triangles) below the ceiling, in alternating colors and
+    // strengths. The triangles face down.
+    std::shared_ptr<Light_Sampler> light_sampler = std::make_shared<Light_Sampler>(LIGHT_BVH_SAMPLING);
+
+    const int grid = 16;
+    const double cell = 355.0 / grid;
+    for (int gx = 0; gx < grid; gx++) {
+        for (int gz = 0; gz < grid; gz++) {
+            Color emission = ((gx + gz) % 2 == 0) ? Color(8, 6, 4) : Color(2, 3, 6);
+            if ((gx * 7 + gz * 3) % 5 == 0)
+                emission = 3 * emission;
+            std::shared_ptr<Diffuse_Light> light = std::make_shared<Diffuse_Light>(emission);
+
+            double x0 = 100 + gx * cell, x1 = x0 + 0.8 * cell;
+            double z0 = 100 + gz * cell, z1 = z0 + 0.8 * cell;
+            std::shared_ptr<Triangle> t0 = std::make_shared<Triangle>(point3D(x0, 554, z0), point3D(x1, 554, z0), point3D(x0, 554, z1), light);
+            std::shared_ptr<Triangle> t1 = std::make_shared<Triangle>(point3D(x1, 554, z0), point3D(x1, 554, z1), point3D(x0, 554, z1), light);
+
+            scene_info.world.add_primitive_to_list(t0);
+            scene_info.world.add_primitive_to_list(t1);
+            light_sampler->add_light(t0, emission);
+            light_sampler->add_light(t1, emission);
+        }
+    }
+
+    auto start = omp_get_wtime();           // measure time
+    // Construct BVH
+    // -------------------------------------------------------------------------------
+    scene_info.world = build_BVH(scene_info.world, BVH_FLAT);
+
+    auto end = omp_get_wtime();
+    std::cout << "BVH Building took: " <<  end - start << std::endl;
+    scene_info.BVH_build_time = end - start;
+
+    // Lights
+    // -------------------------------------------------------------------------------
+    light_sampler->build();
+    scene_info.lights = Primitives_Group(light_sampler);
+
+    return scene_info;
+}
+
 #endif //CUDA_RAY_TRACER_SCENES_H
\ No newline at end of file
@@ -7,11 +7,11 @@
 
 #include "Utilities.h"
 #include "Primitives/Primitives_Group.h"
-#include "Materials/Diffuse.h"
+#include "Materials/Material_Table.h"
 #include "Mathematics/Probability/PDF.h"
 #include "Mathematics/Probability/Primitive_PDF.h"
 #include "Mathematics/Probability/Mixture_PDF.h"
-#include "Materials/Diffuse_Light.h"
+#include "Rendering/Render_Statistics.h"
 
 /*
  * This class contains a collection of radiance(...) functions that calculate the radiance at a given point in the scene.
@@ -24,12 +24,28 @@
  *          radiance_mixture(...): Enables the sampling of different PDFs (lights, primitives, etc...).
  */
 
+/// Reference: Texture Level of Detail Strategies for Real-Time Ray Tracing - Ray Tracing Gems, Chapter 20
+// Ray cones (see Ray). A perfect mirror or refraction keeps the cone's spread; any other bounce scatters light over
+// a wide lobe, so the cone widens by at least diffuse_cone_spread per unit of length from there on. A ray without a
+// cone (spread 0) passes none on, so rendering without ray cones is unchanged.
+const double diffuse_cone_spread = 0.1;
+
+inline void propagate_ray_cone(const Ray& incident_ray, const Intersection_Information& rec, bool is_specular, Ray& scattered_ray) {
+    if (incident_ray.cone_spread == 0.0)
+        return;
+
+    double spread = is_specular ? incident_ray.cone_spread : std::max(incident_ray.cone_spread, diffuse_cone_spread);
+    scattered_ray.set_cone(rec.cone_width, spread);
+}
+
 /// Reference: Fundamentals of Computer Graphics - Section 4.5.2: Shading in Software
 Color radiance(const Ray& r, const Primitive& world, int depth= 10){
     Intersection_Information rec;
     if (depth <= 0)
         return Color(0,0,0);
 
+    count_ray();
+
     if (!world.intersection(r, 0.001, infinity, rec)) {
         // Background color when there is no intersection
         Vec3D unit_direction = unit_vector(r.get_ray_direction());
@@ -39,18 +55,15 @@ Color radiance(const Ray& r, const Primitive& world, int depth= 10){
         //return (1.0 - a) * Color(0.0, 0.0, 0.0) + a * Color(0.1, 0.15, 0.2); // dark space
         return (1.0-a) * Color(1.0, 1.0, 1.0) + a*Color(0.5, 0.7, 1.0);
     }
-    Ray scattered_ray;
-    Color surface_color;
-    MATERIAL_TYPE material_type;
-    std::shared_ptr<PDF> surface_pdf_ptr;
-    double pdf;
-
+    rec.cone_width = r.cone_width_at(rec.t);
     // std::cout << "Normal from shade(): " << rec.normal << std::endl;
-    if (!rec.mat_ptr->evaluate(r, rec, surface_color, scattered_ray, material_type, pdf, surface_pdf_ptr))
+    Material_Sample s = sample_material(*rec.mat_ptr, r, rec);
+    if (!s.scattered)
         return Color(1.0,1.0,1.0);
+    propagate_ray_cone(r, rec, s.is_specular, s.scattered_ray);
 
-    return rec.mat_ptr->BRDF(r, rec, scattered_ray, surface_color) *
-           radiance(scattered_ray, world, depth-1) / pdf;
+    return eval_material(*rec.mat_ptr, r, rec, s.scattered_ray, s.color) *
+           radiance(s.scattered_ray, world, depth-1) / s.pdf;
 }
 
 // radiance() function with background color enabled. Set to (0.0,0.0,0.0) to get a dark background,
@@ -63,27 +76,26 @@ Color radiance_background(const Ray& r, const Primitive& world, int depth= 10, C
     if (depth <= 0)
         return Color(0,0,0);
 
+    count_ray();
+
     if (!world.intersection(r, 0.001, infinity, rec))
         // Background color when there is no intersection
         return background;
 
-    Ray scattered_ray;
-    Color surface_color;
-    MATERIAL_TYPE material_type;
-    std::shared_ptr<PDF> surface_pdf_ptr;
-    double pdf;
+    rec.cone_width = r.cone_width_at(rec.t);
 
-    Color color_from_emission = rec.mat_ptr->emitted(rec.p, rec);
+    Color color_from_emission = material_emission(*rec.mat_ptr, rec);
 
-    if (!rec.mat_ptr->evaluate(r, rec, surface_color, scattered_ray, material_type, pdf, surface_pdf_ptr))
+    Material_Sample s = sample_material(*rec.mat_ptr, r, rec);
+    if (!s.scattered)
         return color_from_emission;
+    propagate_ray_cone(r, rec, s.is_specular, s.scattered_ray);
 
-    if (surface_pdf_ptr == nullptr && (material_type == SPECULAR || material_type == PHONG))
-        return surface_color * radiance_background(scattered_ray, world, depth-1, background);
+    if (s.is_specular)
+        return s.color * radiance_background(s.scattered_ray, world, depth-1, background);
 
-    //  std::cout << "Color from scatter = " << rec.mat_ptr->BRDF(r, rec, scattered_ray, surface_color) << std::endl;
-    return color_from_emission + rec.mat_ptr->BRDF(r, rec, scattered_ray, surface_color) *
-                                 radiance_background(scattered_ray, world, depth-1, background) / pdf;
+    return color_from_emission + eval_material(*rec.mat_ptr, r, rec, s.scattered_ray, s.color) *
+                                 radiance_background(s.scattered_ray, world, depth-1, background) / s.pdf;
 }
 
 Color radiance_sample_light_directly(const Ray& r, const Primitive& world, const std::vector<Diffuse_Light>& lights, int depth= 10, Color background=Color(0, 0, 0)){
@@ -91,20 +103,19 @@ Color radiance_sample_light_directly(const Ray& r, const Primitive& world, const
     if (depth <= 0)
         return Color(0,0,0);
 
+    count_ray();
+
     if (!world.intersection(r, 0.001, infinity, rec))
         // Background color when there is no intersection
         return background;
 
-    Ray scattered_ray;
-    Color surface_color;
-    MATERIAL_TYPE material_type;
-    std::shared_ptr<PDF> surface_pdf_ptr;
-    double pdf;
+    rec.cone_width = r.cone_width_at(rec.t);
 
     // SAMPLE LIGHT DIRECTLY
-    Color color_from_emission = rec.mat_ptr->emitted(rec.p, rec);
+    Color color_from_emission = material_emission(*rec.mat_ptr, rec);
 
-    if (!rec.mat_ptr->evaluate(r, rec, surface_color, scattered_ray, material_type, pdf, surface_pdf_ptr))
+    Material_Sample s = sample_material(*rec.mat_ptr, r, rec);
+    if (!s.scattered)
         return color_from_emission;
 
     Color total_radiance = color_from_emission;
@@ -123,10 +134,11 @@ Color radiance_sample_light_directly(const Ray& r, const Primitive& world, const
         if (light_cosine < 0.000001)
             continue;
 
-        pdf = distance_squared / (light_cosine * light_area);
-        scattered_ray = Ray(rec.p, to_light, r.get_time());
+        double pdf = distance_squared / (light_cosine * light_area);
+        Ray scattered_ray(rec.p, to_light, r.get_time());
+        propagate_ray_cone(r, rec, false, scattered_ray);
 
-        total_radiance += rec.mat_ptr->BRDF(r, rec, scattered_ray, surface_color) *
+        total_radiance += eval_material(*rec.mat_ptr, r, rec, scattered_ray, s.color) *
                           radiance_sample_light_directly(scattered_ray, world, lights, depth - 1, background) / pdf;
     }
     return total_radiance;
@@ -141,34 +153,35 @@ Color radiance_mixture(const Ray& r, const Primitive& world, const Primitive& li
     if (depth <= 0)
         return Color(0,0,0);
 
+    count_ray();
+
     if (!world.intersection(r, 0.001, infinity, rec))
         // Background color when there is no intersection
         return background;
 
-    Ray scattered_ray;
-    Color surface_color;
-    MATERIAL_TYPE material_type;
-    std::shared_ptr<PDF> surface_pdf_ptr;
-    double pdf;
+    rec.cone_width = r.cone_width_at(rec.t);
 
-    Color color_from_emission = rec.mat_ptr->emitted(rec.p, rec);
+    Color color_from_emission = material_emission(*rec.mat_ptr, rec);
 
-    if (!rec.mat_ptr->evaluate(r, rec, surface_color, scattered_ray, material_type, pdf, surface_pdf_ptr))
+    Material_Sample s = sample_material(*rec.mat_ptr, r, rec);
+    if (!s.scattered)
         return color_from_emission;
+    propagate_ray_cone(r, rec, s.is_specular, s.scattered_ray);
 
-    if (surface_pdf_ptr == nullptr && (material_type == SPECULAR || material_type == PHONG))
-        return surface_color * radiance_mixture(scattered_ray, world, lights, depth-1, background);
+    if (s.is_specular)
+        return s.color * radiance_mixture(s.scattered_ray, world, lights, depth-1, background);
 
     auto light_ptr = std::make_shared<Primitive_PDF>(lights, rec.p);
-    Mixture_PDF mixture_pdf(light_ptr, surface_pdf_ptr);
+    Mixture_PDF mixture_pdf(light_ptr, s.surface_pdf_ptr);
 
-    scattered_ray = Ray(rec.p, mixture_pdf.generate_a_random_direction_based_on_PDF(), r.get_time());
+    Ray scattered_ray(rec.p, mixture_pdf.generate_a_random_direction_based_on_PDF(), r.get_time());
     double new_pdf = mixture_pdf.PDF_value(scattered_ray.get_ray_direction());
+    propagate_ray_cone(r, rec, false, scattered_ray);
 
     if (new_pdf == 0.0)
         return color_from_emission;
 
-    return color_from_emission + rec.mat_ptr->BRDF(r, rec, scattered_ray, surface_color) *
+    return color_from_emission + eval_material(*rec.mat_ptr, r, rec, scattered_ray, s.color) *
                                  radiance_mixture(scattered_ray, world, lights, depth-1, background) / new_pdf;
 }
 #endif //CUDA_RAY_TRACER_SHADING_H
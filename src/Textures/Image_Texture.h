@@ -0,0 +1,514 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_IMAGE_TEXTURE_H
+#define CUDA_RAY_TRACER_IMAGE_TEXTURE_H
+
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "Texture.h"
+
+// Image textures. An image is loaded once into a Mipmap (a pyramid of box-filtered levels, each stored in
+// 8x8 tiles so a bilinear lookup touches one or two cache lines), and every Mipmap lives in the process-wide
+// Texture_Cache, which holds at most a fixed number of bytes and evicts the least recently used image when
+// it goes over. An Image_Texture only remembers its file name and asks the cache for its Mipmap, so any number
+// of Image_Textures can refer to large images without keeping them all in memory.
+//
+// Supported files:
+//      .ppm:   binary (P6) or ASCII (P3), 8 or 16 bits per channel
+//      .pfm:   color (PF) or grayscale (Pf), 32-bit float, either byte order
+//      .raw:   headerless 8-bit RGB; the width and height are given to the Image_Texture
+// 8-bit and 16-bit files are decoded with gamma 2, the inverse of gamma_2_correction() on output; PFM
+// files are linear already.
+// -----------------------------------------------------------------------
+struct Texel {
+    float r, g, b;
+};
+
+/// Reference: Physically Based Rendering: From Theory to Implementation (3rd ed.) - Section 10.4: Image Texture
+class Mipmap {
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    Mipmap(int width, int height, const std::vector<Texel>& texels) {
+        // texels: width * height texels, row by row, top row first
+
+        add_level(width, height, texels);
+        std::vector<Texel> previous = texels;
+        while (width > 1 || height > 1) {
+            int next_width = std::max(1, width / 2);
+            int next_height = std::max(1, height / 2);
+            std::vector<Texel> next(static_cast<size_t>(next_width) * next_height);
+
+            // Box filter; an odd row or column is folded into the last texel
+            for (int y = 0; y < next_height; y++) {
+                for (int x = 0; x < next_width; x++) {
+                    int x0 = std::min(2 * x, width - 1), x1 = std::min(2 * x + 1, width - 1);
+                    int y0 = std::min(2 * y, height - 1), y1 = std::min(2 * y + 1, height - 1);
+                    const Texel& a = previous[static_cast<size_t>(y0) * width + x0];
+                    const Texel& b = previous[static_cast<size_t>(y0) * width + x1];
+                    const Texel& c = previous[static_cast<size_t>(y1) * width + x0];
+                    const Texel& d = previous[static_cast<size_t>(y1) * width + x1];
+                    next[static_cast<size_t>(y) * next_width + x] = {0.25f * (a.r + b.r + c.r + d.r),
+                                                                     0.25f * (a.g + b.g + c.g + d.g),
+                                                                     0.25f * (a.b + b.b + c.b + d.b)};
+                }
+            }
+
+            width = next_width;
+            height = next_height;
+            add_level(width, height, next);
+            previous.swap(next);
+        }
+    }
+
+    // Lookups
+    // -----------------------------------------------------------------------
+    Color bilinear(int level, double u, double v) const {
+        // Bilinear interpolation of the four texels around (u,v) on the given level; the texture repeats
+
+        const Level& l = levels[level];
+        double x = u * l.width - 0.5;
+        double y = (1.0 - v) * l.height - 0.5;             // v = 0 is the bottom row of the image
+        double x_floor = std::floor(x), y_floor = std::floor(y);
+        double dx = x - x_floor, dy = y - y_floor;
+        int x0 = static_cast<int>(x_floor), y0 = static_cast<int>(y_floor);
+
+        Color c00 = texel(l, x0, y0), c10 = texel(l, x0 + 1, y0);
+        Color c01 = texel(l, x0, y0 + 1), c11 = texel(l, x0 + 1, y0 + 1);
+        return (1 - dy) * ((1 - dx) * c00 + dx * c10) + dy * ((1 - dx) * c01 + dx * c11);
+    }
+
+    Color trilinear(double u, double v, double width) const {
+        // width: size of the filter footprint in texture space ([0,1] covers the image once). Picks the two
+        // levels whose texel size brackets it and blends their bilinear lookups.
+
+        double resolution = std::max(levels[0].width, levels[0].height);
+        double level = std::log2(std::max(width * resolution, 1e-8));
+        if (level <= 0.0)
+            return bilinear(0, u, v);
+        if (level >= number_of_levels() - 1)
+            return bilinear(number_of_levels() - 1, u, v);
+
+        int l0 = static_cast<int>(level);
+        double t = level - l0;
+        return (1 - t) * bilinear(l0, u, v) + t * bilinear(l0 + 1, u, v);
+    }
+
+    // Getters
+    // -----------------------------------------------------------------------
+    int number_of_levels() const { return static_cast<int>(levels.size()); }
+    int get_width() const { return levels[0].width; }
+    int get_height() const { return levels[0].height; }
+
+    size_t bytes() const {
+        size_t total = 0;
+        for (const Level& l : levels)
+            total += l.tiles.size() * sizeof(Texel);
+        return total;
+    }
+
+private:
+    static const int tile_size = 8;                         // texels per side of a tile
+
+    struct Level {
+        int width, height;
+        int tiles_per_row;
+        std::vector<Texel> tiles;                           // tile by tile, each tile row by row
+    };
+
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    void add_level(int width, int height, const std::vector<Texel>& texels) {
+        Level l;
+        l.width = width;
+        l.height = height;
+        l.tiles_per_row = (width + tile_size - 1) / tile_size;
+        int tiles_per_column = (height + tile_size - 1) / tile_size;
+        l.tiles.assign(static_cast<size_t>(l.tiles_per_row) * tiles_per_column * tile_size * tile_size, Texel{0, 0, 0});
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+                l.tiles[tiled_index(l, x, y)] = texels[static_cast<size_t>(y) * width + x];
+        levels.push_back(l);
+    }
+
+    static size_t tiled_index(const Level& l, int x, int y) {
+        size_t tile = static_cast<size_t>(y / tile_size) * l.tiles_per_row + x / tile_size;
+        return tile * tile_size * tile_size + (y % tile_size) * tile_size + (x % tile_size);
+    }
+
+    static Color texel(const Level& l, int x, int y) {
+        // Wraps (x,y) around the level, so the texture repeats
+
+        x %= l.width;
+        y %= l.height;
+        if (x < 0) x += l.width;
+        if (y < 0) y += l.height;
+        const Texel& t = l.tiles[tiled_index(l, x, y)];
+        return Color(t.r, t.g, t.b);
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    std::vector<Level> levels;                              // levels[0] is the full-resolution image
+};
+
+// Image Loaders
+// -----------------------------------------------------------------------
+inline void skip_PPM_whitespace_and_comments(std::istream& in) {
+    while (true) {
+        int c = in.peek();
+        if (c == std::char_traits<char>::eof()) {
+            return;
+        } else if (c == '#') {
+            std::string comment;
+            std::getline(in, comment);
+        } else if (std::isspace(c)) {
+            in.get();
+        } else {
+            return;
+        }
+    }
+}
+
+/// Reference: PPM Format Specification - https://netpbm.sourceforge.net/doc/ppm.html
+inline void load_PPM(const std::string& file_name, int& width, int& height, std::vector<Texel>& texels) {
+    std::ifstream in(file_name, std::ios_base::in | std::ios_base::binary);
+    if (!in) {
+        std::cerr << "COULD NOT OPEN THE TEXTURE " << file_name << "!\n";
+        exit(0);
+    }
+
+    std::string magic;
+    int max_value;
+    in >> magic;
+    skip_PPM_whitespace_and_comments(in);
+    in >> width;
+    skip_PPM_whitespace_and_comments(in);
+    in >> height;
+    skip_PPM_whitespace_and_comments(in);
+    in >> max_value;
+    if (!in || (magic != "P3" && magic != "P6") || width <= 0 || height <= 0 || max_value <= 0 || max_value > 65535) {
+        std::cerr << "THE TEXTURE " << file_name << " IS NOT A VALID PPM FILE!\n";
+        exit(0);
+    }
+    in.get();                                               // the single whitespace before the raster
+
+    size_t n = static_cast<size_t>(width) * height * 3;
+    std::vector<double> values(n);
+    if (magic == "P3") {
+        for (size_t i = 0; i < n; i++)
+            in >> values[i];
+    } else if (max_value < 256) {
+        std::vector<unsigned char> bytes(n);
+        in.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(n));
+        for (size_t i = 0; i < n; i++)
+            values[i] = bytes[i];
+    } else {
+        std::vector<unsigned char> bytes(2 * n);            // 16-bit values are big-endian
+        in.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(2 * n));
+        for (size_t i = 0; i < n; i++)
+            values[i] = bytes[2 * i] * 256 + bytes[2 * i + 1];
+    }
+    if (!in) {
+        std::cerr << "THE TEXTURE " << file_name << " IS TRUNCATED!\n";
+        exit(0);
+    }
+
+    texels.resize(static_cast<size_t>(width) * height);
+    for (size_t i = 0; i < texels.size(); i++) {
+        double r = values[3 * i] / max_value, g = values[3 * i + 1] / max_value, b = values[3 * i + 2] / max_value;
+        texels[i] = {static_cast<float>(r * r), static_cast<float>(g * g), static_cast<float>(b * b)};
+    }
+}
+
+/// Reference: PFM Format - https://www.pauldebevec.com/Research/HDR/PFM/
+inline void load_PFM(const std::string& file_name, int& width, int& height, std::vector<Texel>& texels) {
+    std::ifstream in(file_name, std::ios_base::in | std::ios_base::binary);
+    if (!in) {
+        std::cerr << "COULD NOT OPEN THE TEXTURE " << file_name << "!\n";
+        exit(0);
+    }
+
+    std::string magic;
+    double scale;
+    in >> magic >> width >> height >> scale;
+    if (!in || (magic != "PF" && magic != "Pf") || width <= 0 || height <= 0 || scale == 0.0) {
+        std::cerr << "THE TEXTURE " << file_name << " IS NOT A VALID PFM FILE!\n";
+        exit(0);
+    }
+    in.get();
+
+    int channels = magic == "PF" ? 3 : 1;
+    size_t n = static_cast<size_t>(width) * height * channels;
+    std::vector<uint32_t> words(n);
+    in.read(reinterpret_cast<char*>(words.data()), static_cast<std::streamsize>(n * sizeof(uint32_t)));
+    if (!in) {
+        std::cerr << "THE TEXTURE " << file_name << " IS TRUNCATED!\n";
+        exit(0);
+    }
+
+    // A negative scale means little-endian data; swap the bytes if that is not this machine's order
+    uint32_t one = 1;
+    bool little_endian_host = *reinterpret_cast<unsigned char*>(&one) == 1;
+    if ((scale < 0) != little_endian_host)
+        for (uint32_t& w : words)
+            w = (w >> 24) | ((w >> 8) & 0xFF00u) | ((w << 8) & 0xFF0000u) | (w << 24);
+
+    std::vector<float> values(n);
+    std::memcpy(values.data(), words.data(), n * sizeof(float));
+
+    // PFM rows go from the bottom of the image to the top
+    texels.resize(static_cast<size_t>(width) * height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const float* v = &values[(static_cast<size_t>(height - 1 - y) * width + x) * channels];
+            texels[static_cast<size_t>(y) * width + x] = channels == 3 ? Texel{v[0], v[1], v[2]} : Texel{v[0], v[0], v[0]};
+        }
+    }
+}
+
+inline void load_raw(const std::string& file_name, int width, int height, std::vector<Texel>& texels) {
+    std::ifstream in(file_name, std::ios_base::in | std::ios_base::binary);
+    if (!in) {
+        std::cerr << "COULD NOT OPEN THE TEXTURE " << file_name << "!\n";
+        exit(0);
+    }
+    if (width <= 0 || height <= 0) {
+        std::cerr << "THE RAW TEXTURE " << file_name << " NEEDS A WIDTH AND A HEIGHT!\n";
+        exit(0);
+    }
+
+    size_t n = static_cast<size_t>(width) * height * 3;
+    std::vector<unsigned char> bytes(n);
+    in.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(n));
+    if (!in) {
+        std::cerr << "THE TEXTURE " << file_name << " IS TRUNCATED!\n";
+        exit(0);
+    }
+
+    texels.resize(static_cast<size_t>(width) * height);
+    for (size_t i = 0; i < texels.size(); i++) {
+        double r = bytes[3 * i] / 255.0, g = bytes[3 * i + 1] / 255.0, b = bytes[3 * i + 2] / 255.0;
+        texels[i] = {static_cast<float>(r * r), static_cast<float>(g * g), static_cast<float>(b * b)};
+    }
+}
+
+inline std::shared_ptr<const Mipmap> load_mipmap(const std::string& file_name, int raw_width = 0, int raw_height = 0) {
+    // Picks the loader from the file extension
+
+    std::string extension = file_name.substr(file_name.find_last_of('.') + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+    int width = raw_width, height = raw_height;
+    std::vector<Texel> texels;
+    if (extension == "ppm")
+        load_PPM(file_name, width, height, texels);
+    else if (extension == "pfm")
+        load_PFM(file_name, width, height, texels);
+    else if (extension == "raw")
+        load_raw(file_name, width, height, texels);
+    else {
+        std::cerr << "UNSUPPORTED TEXTURE FORMAT: " << file_name << "\n";
+        exit(0);
+    }
+
+    return std::make_shared<const Mipmap>(width, height, texels);
+}
+
+// Texture Cache
+// -----------------------------------------------------------------------
+class Texture_Cache {
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    explicit Texture_Cache(size_t capacity_in_bytes) : capacity(capacity_in_bytes) {}
+
+    // Cache Interface
+    // -----------------------------------------------------------------------
+    std::shared_ptr<const Mipmap> get(const std::string& file_name, int raw_width = 0, int raw_height = 0) {
+        // Returns the image, loading it (and evicting the least recently used images) if it is not cached.
+        // A caller may keep the returned pointer; an evicted image is freed when its last user lets go.
+        // The file is read outside the lock: a miss first enters a placeholder future, so other threads
+        // can use the cached images meanwhile, and those that want the same file wait on the future.
+
+        std::unique_lock<std::mutex> lock(mutex);
+
+        auto found = entries.find(file_name);
+        if (found != entries.end()) {
+            hits++;
+            recently_used.splice(recently_used.begin(), recently_used, found->second.position);
+            std::shared_future<std::shared_ptr<const Mipmap>> pending = found->second.mipmap;
+            lock.unlock();
+            return pending.get();
+        }
+
+        misses++;
+        std::promise<std::shared_ptr<const Mipmap>> loaded;
+        Entry e;
+        e.mipmap = loaded.get_future().share();
+        e.load = ++loads;
+        recently_used.push_front(file_name);
+        e.position = recently_used.begin();
+        entries[file_name] = e;
+        lock.unlock();
+
+        std::shared_ptr<const Mipmap> mipmap = load_mipmap(file_name, raw_width, raw_height);
+        loaded.set_value(mipmap);
+
+        // Count the bytes, unless the placeholder was evicted (or the cache cleared) during the load
+        lock.lock();
+        found = entries.find(file_name);
+        if (found != entries.end() && found->second.load == e.load) {
+            found->second.bytes = mipmap->bytes();
+            used += found->second.bytes;
+            evict();
+        }
+        return mipmap;
+    }
+
+    void set_capacity(size_t capacity_in_bytes) {
+        std::lock_guard<std::mutex> lock(mutex);
+        capacity = capacity_in_bytes;
+        evict();
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+        recently_used.clear();
+        used = 0;
+        generation++;
+    }
+
+    // Getters
+    // -----------------------------------------------------------------------
+    size_t bytes_used() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return used;
+    }
+    unsigned long get_generation() const { return generation; }     // changes whenever an image leaves the cache
+    unsigned long get_hits() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return hits;
+    }
+    unsigned long get_misses() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return misses;
+    }
+
+private:
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    void evict() {
+        // Drops the least recently used images until the cache fits. The most recent one stays, even if
+        // it alone is over the capacity. Images still loading count 0 bytes; their loader adds them.
+
+        while (used > capacity && recently_used.size() > 1) {
+            auto evicted = entries.find(recently_used.back());
+            used -= evicted->second.bytes;
+            entries.erase(evicted);
+            recently_used.pop_back();
+            generation++;
+        }
+    }
+
+    struct Entry {
+        std::shared_future<std::shared_ptr<const Mipmap>> mipmap;     // ready once the loading thread is done
+        size_t bytes = 0;                                   // 0 while loading
+        unsigned long load = 0;                             // tells a reloaded file from the placeholder it replaced
+        std::list<std::string>::iterator position;          // in recently_used
+    };
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    mutable std::mutex mutex;
+    size_t capacity;                                        // bytes
+    size_t used = 0;
+    std::unordered_map<std::string, Entry> entries;
+    std::list<std::string> recently_used;                   // most recently used first
+    std::atomic<unsigned long> generation{0};
+    unsigned long hits = 0, misses = 0;
+    unsigned long loads = 0;
+};
+
+inline Texture_Cache& texture_cache() {
+    // The cache shared by all the image textures; 512 MB unless set_capacity() is called
+
+    static Texture_Cache cache(static_cast<size_t>(512) << 20);
+    return cache;
+}
+
+// Image Texture
+// -----------------------------------------------------------------------
+class Image_Texture : public Texture {
+public:
+    // Constructor
+    // -----------------------------------------------------------------------
+    explicit Image_Texture(const std::string& file_name, int raw_width = 0, int raw_height = 0) :
+            file_name(file_name), raw_width(raw_width), raw_height(raw_height), id(next_id()) {}
+
+    // Overloaded Functions
+    // -----------------------------------------------------------------------
+    Color value_at(double u, double v, const point3D &/*p*/) const override {
+        // Without a footprint: bilinear on the full-resolution image
+
+        return mipmap()->bilinear(0, u, v);
+    }
+
+    Color filtered_value_at(double u, double v, const point3D &/*p*/, double footprint) const override {
+        // Trilinear between the two mipmap levels that match the footprint
+
+        return mipmap()->trilinear(u, v, footprint);
+    }
+
+private:
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    std::shared_ptr<const Mipmap> mipmap() const {
+        // Each thread remembers the image of every texture it used, so lookups don't lock the cache. The
+        // memo only holds weak pointers, so evicted images are still freed, and it is dropped whenever the
+        // cache evicts something. The returned pointer keeps the image alive for the caller's lookup.
+
+        struct Memo {
+            unsigned long generation = 0;
+            std::weak_ptr<const Mipmap> mipmap;
+        };
+        static thread_local std::unordered_map<unsigned long, Memo> memos;     // by texture id
+
+        Texture_Cache& cache = texture_cache();
+        Memo& memo = memos[id];
+        unsigned long generation = cache.get_generation();
+        if (memo.generation == generation) {
+            std::shared_ptr<const Mipmap> cached = memo.mipmap.lock();
+            if (cached)
+                return cached;
+        }
+
+        std::shared_ptr<const Mipmap> loaded = cache.get(file_name, raw_width, raw_height);
+        memo.generation = generation;
+        memo.mipmap = loaded;
+        return loaded;
+    }
+
+    static unsigned long next_id() {
+        static std::atomic<unsigned long> counter{0};
+        return ++counter;
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    std::string file_name;
+    int raw_width, raw_height;                              // only for .raw files
+    unsigned long id;                                       // tells the textures apart in the per-thread memo
+};
+
+#endif //CUDA_RAY_TRACER_IMAGE_TEXTURE_H
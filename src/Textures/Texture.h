@@ -11,6 +11,13 @@ class Texture {
 public:
     virtual ~Texture() = default;
     virtual Color value_at(double u, double v, const point3D& p) const = 0;
+
+    virtual Color filtered_value_at(double u, double v, const point3D& p, double /*footprint*/) const {
+        // The texture averaged over a footprint of the given width around (u,v), in texture space. Only
+        // image textures filter; the procedural ones are point-sampled.
+
+        return value_at(u, v, p);
+    }
 };
 
 class Constant_Color : public Texture {
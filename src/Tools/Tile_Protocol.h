@@ -0,0 +1,73 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+#ifndef CUDA_RAY_TRACER_TILE_PROTOCOL_H
+#define CUDA_RAY_TRACER_TILE_PROTOCOL_H
+
+#include <cstdint>
+#include <cerrno>
+#include <unistd.h>
+
+// The messages between the render coordinator and its workers (see render_coordinator.cpp). A worker reads
+// requests on its standard input and answers on its standard output, so the same worker runs as a local
+// child process over pipes or on another machine behind anything that forwards a byte stream (ssh, socat).
+// Messages are the structs below as raw bytes; both ends are the same build.
+//
+//      worker -> coordinator   Worker_Hello, once the scene is built
+//      coordinator -> worker   Tile_Request (a tile_id < 0 tells the worker to exit)
+//      worker -> coordinator   Tile_Result_Header, then pixel_count * 3 doubles: the sums of the samples of
+//                              the tile's pixels, row by row
+// -----------------------------------------------------------------------
+const int32_t TILE_PROTOCOL_MAGIC = 0x54494c31;        // "TIL1"
+
+struct Worker_Hello {
+    int32_t magic;
+    int32_t image_width;
+    int32_t image_height;
+    int32_t samples_per_pixel;
+};
+
+struct Tile_Request {
+    int32_t tile_id;
+    int32_t x0, y0, x1, y1;
+};
+
+struct Tile_Result_Header {
+    int32_t tile_id;
+    int32_t pixel_count;
+    int64_t rays;                   // rays traced for the tile
+    double seconds;                 // time the worker spent rendering it
+};
+
+inline bool write_fully(int fd, const void* data, size_t size) {
+    const char* p = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t n = write(fd, p, size);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+inline bool read_fully(int fd, void* data, size_t size) {
+    // False at end of file (the other end is gone) or on an error
+
+    char* p = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t n = read(fd, p, size);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+#endif //CUDA_RAY_TRACER_TILE_PROTOCOL_H
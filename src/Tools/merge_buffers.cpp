@@ -0,0 +1,88 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+// Adds up the accumulation buffers written by CUDA_Ray_Tracer_Render_Samples (or by the checkpointed
+// renderer) and writes the image:
+//
+//      CUDA_Ray_Tracer_Merge_Buffers [--buffer merged.acc] IMAGE_NAME part_0.acc part_1.acc ...
+//
+// writes IMAGE_NAME.ppm, each pixel averaged over all the samples the buffers hold. Buffers that are still
+// being rendered can be merged too, for a preview: their pixels simply have fewer samples so far. The
+// buffers must come from the same scene and image size, and their sample ranges must not overlap. The
+// --buffer file can be resumed or merged again, so it is only written when the ranges leave no gaps.
+
+#include "../Rendering/Accumulation_Buffer.h"
+#include <algorithm>
+
+struct Sample_Range {
+    std::string file;
+    int first;
+    int end;                        // one past the last sample any pixel of the buffer holds
+};
+
+int main(int argc, char** argv) {
+    std::string merged_file;
+    std::vector<std::string> arguments;
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+        if (argument == "--buffer" && i + 1 < argc)
+            merged_file = argv[++i];
+        else
+            arguments.push_back(argument);
+    }
+
+    if (arguments.size() < 2) {
+        std::cerr << "Usage: CUDA_Ray_Tracer_Merge_Buffers [--buffer MERGED_FILE] IMAGE_NAME BUFFER...\n"
+                  << "  writes IMAGE_NAME.ppm from the sum of the accumulation buffers (and MERGED_FILE, if given)\n";
+        return 1;
+    }
+
+    const std::string image_name = arguments[0];
+    std::vector<Accumulation_Buffer> buffers(arguments.size() - 1);
+    std::vector<Sample_Range> ranges;
+
+    for (size_t b = 1; b < arguments.size(); b++) {
+        Accumulation_Buffer& buffer = buffers[b - 1];
+        if (!buffer.load(arguments[b])) {
+            std::cerr << "COULD NOT READ " << arguments[b] << "\n";
+            return 1;
+        }
+
+        ranges.push_back({arguments[b], buffer.get_first_sample(),
+                          buffer.get_first_sample() + static_cast<int>(buffer.maximum_sample_count())});
+        std::cout << arguments[b] << ": " << buffer.get_label() << ", " << buffer.get_width() << "x" << buffer.get_height()
+                  << ", first sample " << buffer.get_first_sample() << ", " << buffer.minimum_sample_count() << " to "
+                  << buffer.maximum_sample_count() << " samples per pixel" << std::endl;
+    }
+
+    // Merged in order of their first sample, so that ranges which join up leave no gap at any step
+    std::stable_sort(buffers.begin(), buffers.end(), [](const Accumulation_Buffer& a, const Accumulation_Buffer& b) {
+        return a.get_first_sample() < b.get_first_sample();
+    });
+    Accumulation_Buffer merged = buffers[0];
+    for (size_t b = 1; b < buffers.size(); b++) {
+        if (!merged.merge(buffers[b]))
+            return 1;
+    }
+
+    // The same sample index twice would count one sample vector twice
+    std::sort(ranges.begin(), ranges.end(), [](const Sample_Range& a, const Sample_Range& b) { return a.first < b.first; });
+    for (size_t r = 1; r < ranges.size(); r++) {
+        if (ranges[r].first < ranges[r - 1].end) {
+            std::cerr << "OVERLAPPING SAMPLE RANGES: " << ranges[r - 1].file << " [" << ranges[r - 1].first << ", "
+                      << ranges[r - 1].end << ") AND " << ranges[r].file << " [" << ranges[r].first << ", " << ranges[r].end << ")\n";
+            return 1;
+        }
+    }
+
+    merged.write_PPM(image_name + ".ppm");
+    if (!merged_file.empty() && !merged.save(merged_file)) {
+        std::cerr << "COULD NOT WRITE " << merged_file << "\n";
+        return 1;
+    }
+
+    std::cout << "Merged " << arguments.size() - 1 << " buffers into " << image_name << ".ppm: "
+              << merged.minimum_sample_count() << " to " << merged.maximum_sample_count() << " samples per pixel" << std::endl;
+    return 0;
+}
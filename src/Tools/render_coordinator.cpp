@@ -0,0 +1,619 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+// Tile-distributed rendering. The coordinator starts worker processes, splits the image into tiles, hands
+// the tiles out one at a time, and assembles the returned pixels into the image:
+//
+//      CUDA_Ray_Tracer_Render_Coordinator --scene full_Cornell --workers 4 --threads-per-worker 4 --tile 32
+//
+// Each worker is this same program started with --worker: it builds the scene from its name with the
+// constructors in Scenes.h, then renders the tiles it is sent (see Tile_Protocol.h). The coordinator never
+// builds the scene. It
+//      - gives a worker its next tile as soon as the previous one comes back, so fast workers do more tiles;
+//      - puts the tile of a worker that crashed (its pipe closed) back at the front of the queue;
+//      - kills a worker that spends more than --tile-timeout seconds on one tile and re-queues the tile, and
+//        one that takes longer than that to build the scene;
+//      - once the queue is empty, gives idle workers a copy of any tile that has been out for more than
+//        --straggler-factor times the average tile time; whichever copy comes back first is used;
+//      - reports the tiles, rays and throughput of every worker at the end.
+// The workers here are local child processes talking over pipes; the protocol is a plain byte stream on
+// the worker's standard input and output.
+
+#include "../Rendering/Tile_Rendering_Functions.h"
+#include "../Scene_Registry.h"
+#include "Tile_Protocol.h"
+
+#include <deque>
+#include <cstring>
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+struct Coordinator_Settings {
+    std::string scene;
+    std::string image_name = "coordinated_render";
+    int workers = 2;
+    int threads_per_worker = 1;
+    int tile_size = 32;
+    int samples_per_pixel = 0;              // 0 keeps the scene's value (same for width and depth)
+    int image_width = 0;
+    int max_depth = 0;
+    double tile_timeout = 0.0;              // seconds; 0 waits forever
+    double straggler_factor = 3.0;
+    bool worker = false;                    // run as a worker (started by the coordinator)
+    std::string program;                    // argv[0], which the workers are started from
+};
+
+void print_usage() {
+    std::cerr << "Usage: CUDA_Ray_Tracer_Render_Coordinator --scene NAME [options]\n"
+              << "  --scene NAME              " << list_entries(scenes) << ", or a .scene file\n"
+              << "  --workers N               worker processes to start (default 2)\n"
+              << "  --threads-per-worker N    OpenMP threads in each worker (default 1)\n"
+              << "  --tile N                  tile size in pixels (default 32)\n"
+              << "  --spp N                   samples per pixel (default: the scene's)\n"
+              << "  --width N                 image width; the height follows the scene's aspect ratio (default: the scene's)\n"
+              << "  --depth N                 maximum ray depth (default: the scene's)\n"
+              << "  --image NAME              name of the rendered .ppm (default coordinated_render)\n"
+              << "  --tile-timeout SECONDS    kill a worker that takes longer on one tile, or to build the scene, and re-queue the tile (default: never)\n"
+              << "  --straggler-factor X      duplicate tiles out for X times the average tile time once the queue is empty (default 3)\n";
+}
+
+bool parse_arguments(int argc, char** argv, Coordinator_Settings& settings) {
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (option == "--help" || option == "-h")
+            return false;
+        if (option == "--worker") {
+            settings.worker = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "MISSING VALUE FOR " << option << "\n";
+            return false;
+        }
+        std::string value = argv[++i];
+
+        if (option == "--scene") settings.scene = value;
+        else if (option == "--workers") settings.workers = std::atoi(value.c_str());
+        else if (option == "--threads-per-worker") settings.threads_per_worker = std::atoi(value.c_str());
+        else if (option == "--tile") settings.tile_size = std::atoi(value.c_str());
+        else if (option == "--spp") settings.samples_per_pixel = std::atoi(value.c_str());
+        else if (option == "--width") settings.image_width = std::atoi(value.c_str());
+        else if (option == "--depth") settings.max_depth = std::atoi(value.c_str());
+        else if (option == "--image") settings.image_name = value;
+        else if (option == "--tile-timeout") settings.tile_timeout = std::atof(value.c_str());
+        else if (option == "--straggler-factor") settings.straggler_factor = std::atof(value.c_str());
+        else {
+            std::cerr << "INVALID OPTION: " << option << "\n";
+            return false;
+        }
+    }
+
+    if (!scene_exists(settings.scene)) {
+        std::cerr << "UNKNOWN SCENE: " << settings.scene << "\n";
+        return false;
+    }
+    if (settings.workers < 1 || settings.threads_per_worker < 1 || settings.tile_size < 1) {
+        std::cerr << "WORKERS, THREADS AND TILE SIZE MUST BE POSITIVE!\n";
+        return false;
+    }
+    return true;
+}
+
+// Worker
+// -----------------------------------------------------------------------
+int run_worker(const Coordinator_Settings& settings) {
+    // The protocol uses the original standard output; everything the scenes and renderers print goes to stderr
+
+    int protocol_in = 0;
+    int protocol_out = dup(1);
+    dup2(2, 1);
+
+    Scene_Information scene_info = build_scene(settings.scene);
+    if (settings.image_width > 0) {
+        scene_info.image_width = settings.image_width;
+        scene_info.image_height = static_cast<int>(scene_info.image_width / scene_info.aspect_ratio);
+    }
+    if (settings.samples_per_pixel > 0)
+        scene_info.samples_per_pixel = settings.samples_per_pixel;
+    if (settings.max_depth > 0)
+        scene_info.max_depth = settings.max_depth;
+    scene_info.number_of_threads_used = settings.threads_per_worker;
+
+    Camera cam = scene_info.camera;
+    if (scene_info.ray_cones)
+        cam.enable_ray_cones(scene_info.image_height);
+
+    Worker_Hello hello = {TILE_PROTOCOL_MAGIC, scene_info.image_width, scene_info.image_height, scene_info.samples_per_pixel};
+    if (!write_fully(protocol_out, &hello, sizeof(hello)))
+        return 1;
+
+    Tile_Request request;
+    std::vector<Color> sums;
+    std::vector<double> payload;
+    while (read_fully(protocol_in, &request, sizeof(request)) && request.tile_id >= 0) {
+        Image_Tile tile = {request.x0, request.y0, request.x1, request.y1};
+
+        reset_ray_counters();
+        double start = omp_get_wtime();
+        render_tile_radiance_mixture(scene_info, cam, tile, sums);
+
+        Tile_Result_Header header;
+        header.tile_id = request.tile_id;
+        header.pixel_count = static_cast<int32_t>(sums.size());
+        header.rays = number_of_rays_traced();
+        header.seconds = omp_get_wtime() - start;
+
+        payload.resize(3 * sums.size());
+        for (size_t k = 0; k < sums.size(); k++) {
+            payload[3 * k] = sums[k].x();
+            payload[3 * k + 1] = sums[k].y();
+            payload[3 * k + 2] = sums[k].z();
+        }
+        if (!write_fully(protocol_out, &header, sizeof(header)) ||
+            !write_fully(protocol_out, payload.data(), payload.size() * sizeof(double)))
+            return 1;
+    }
+    return 0;
+}
+
+// Coordinator
+// -----------------------------------------------------------------------
+enum WORKER_STATE {WORKER_RUNNING, WORKER_FINISHED, WORKER_CRASHED, WORKER_KILLED};
+
+struct Worker_Process {
+    pid_t pid = -1;
+    int to_worker = -1;                 // the worker's standard input
+    int from_worker = -1;               // the worker's standard output
+    WORKER_STATE state = WORKER_RUNNING;
+    int tile = -1;                      // tile being rendered, -1 if idle
+    double tile_start = 0.0;
+    std::vector<char> inbox;            // the part of the current result received so far
+
+    // Statistics
+    int tiles = 0;                      // tiles whose result was used
+    int duplicates = 0;                 // results that came back after another copy of the tile
+    long long pixels = 0;
+    long long rays = 0;
+    double render_seconds = 0.0;        // as measured by the worker
+};
+
+bool close_on_exec_pipe(int fds[2]) {
+    // pipe2(O_CLOEXEC) is Linux-only; the coordinator is single-threaded, so setting the flag afterwards is safe
+
+    return pipe(fds) == 0 && fcntl(fds[0], F_SETFD, FD_CLOEXEC) == 0 && fcntl(fds[1], F_SETFD, FD_CLOEXEC) == 0;
+}
+
+bool start_worker(const std::string& program, const std::vector<std::string>& arguments, Worker_Process& worker) {
+    // The worker is this program again: execvp() looks program (the coordinator's argv[0]) up the way the
+    // shell did, in the PATH if it has no slash
+
+    int to_child[2], from_child[2];
+    if (!close_on_exec_pipe(to_child) || !close_on_exec_pipe(from_child))
+        return false;
+
+    pid_t pid = fork();
+    if (pid < 0)
+        return false;
+
+    if (pid == 0) {
+        // dup2 clears FD_CLOEXEC on the copies, so the worker keeps only its standard input and output
+        dup2(to_child[0], 0);
+        dup2(from_child[1], 1);
+        std::vector<char*> argv;
+        for (const std::string& a : arguments)
+            argv.push_back(const_cast<char*>(a.c_str()));
+        argv.push_back(nullptr);
+        execvp(program.c_str(), argv.data());
+        std::cerr << "COULD NOT START WORKER\n";
+        _exit(127);
+    }
+
+    close(to_child[0]);
+    close(from_child[1]);
+    worker.pid = pid;
+    worker.to_worker = to_child[1];
+    worker.from_worker = from_child[0];
+    return true;
+}
+
+void stop_worker(Worker_Process& worker, WORKER_STATE state) {
+    if (worker.state != WORKER_RUNNING)
+        return;
+    // Only an idle worker that was told to quit exits by itself; a crashed one may be a zombie already
+    if (state != WORKER_FINISHED || worker.tile >= 0)
+        kill(worker.pid, SIGKILL);
+
+    close(worker.to_worker);
+    close(worker.from_worker);
+    waitpid(worker.pid, nullptr, 0);
+    worker.state = state;
+    worker.tile = -1;
+}
+
+class Render_Coordinator {
+public:
+    // Constructors
+    // -----------------------------------------------------------------------
+    explicit Render_Coordinator(const Coordinator_Settings& settings) : settings(settings) {}
+
+    // Rendering
+    // -----------------------------------------------------------------------
+    int run() {
+        std::signal(SIGPIPE, SIG_IGN);          // a crashed worker shows up as a failed write instead
+        double start = omp_get_wtime();
+
+        if (!start_workers() || !receive_hellos())
+            return 1;
+
+        tiles = split_into_tiles(image_width, image_height, settings.tile_size);
+        done.assign(tiles.size(), false);
+        copies_out.assign(tiles.size(), 0);
+        for (int t = 0; t < static_cast<int>(tiles.size()); t++)
+            queue.push_back(t);
+        pixel_colors.assign(image_height, std::vector<Color>(image_width, Color(0, 0, 0)));
+
+        std::cerr << "Rendering " << tiles.size() << " tiles of " << settings.tile_size << "x" << settings.tile_size
+                  << " on " << workers.size() << " workers\n";
+
+        while (tiles_done < static_cast<int>(tiles.size())) {
+            dispatch();
+            if (running_workers() == 0) {
+                std::cerr << "ALL WORKERS ARE GONE WITH " << tiles.size() - tiles_done << " TILES LEFT!\n";
+                return 1;
+            }
+            collect(100);
+            enforce_timeout();
+        }
+
+        for (Worker_Process& w : workers) {
+            Tile_Request quit = {-1, 0, 0, 0, 0};
+            if (w.state == WORKER_RUNNING && w.tile < 0)
+                write_fully(w.to_worker, &quit, sizeof(quit));
+            stop_worker(w, w.tile >= 0 ? WORKER_KILLED : WORKER_FINISHED);
+        }
+
+        double seconds = omp_get_wtime() - start;
+        write_image();
+        report(seconds);
+        return 0;
+    }
+
+private:
+    // Supporting Functions
+    // -----------------------------------------------------------------------
+    bool start_workers() {
+        std::vector<std::string> arguments = {"CUDA_Ray_Tracer_Render_Worker", "--worker", "--scene", settings.scene,
+                                              "--threads-per-worker", std::to_string(settings.threads_per_worker)};
+        if (settings.samples_per_pixel > 0) { arguments.push_back("--spp"); arguments.push_back(std::to_string(settings.samples_per_pixel)); }
+        if (settings.image_width > 0) { arguments.push_back("--width"); arguments.push_back(std::to_string(settings.image_width)); }
+        if (settings.max_depth > 0) { arguments.push_back("--depth"); arguments.push_back(std::to_string(settings.max_depth)); }
+
+        workers.resize(settings.workers);
+        for (Worker_Process& w : workers) {
+            if (!start_worker(settings.program, arguments, w)) {
+                std::cerr << "COULD NOT START A WORKER PROCESS!\n";
+                return false;
+            }
+            std::cerr << "Started worker " << w.pid << "\n";
+        }
+        return true;
+    }
+
+    bool receive_hellos() {
+        // Every worker builds the scene and says how big the image is; they all have to agree. The hellos are
+        // read piecemeal like the results (see receive()), and building the scene is held to --tile-timeout,
+        // so a worker that hangs before its hello cannot stall the coordinator
+
+        for (Worker_Process& w : workers)
+            fcntl(w.from_worker, F_SETFL, O_NONBLOCK);
+        std::vector<bool> greeted(workers.size(), false);
+        double start = omp_get_wtime();
+
+        while (true) {
+            std::vector<pollfd> fds;
+            std::vector<size_t> polled;
+            for (size_t k = 0; k < workers.size(); k++) {
+                if (workers[k].state == WORKER_RUNNING && !greeted[k]) {
+                    fds.push_back({workers[k].from_worker, POLLIN, 0});
+                    polled.push_back(k);
+                }
+            }
+            if (fds.empty())
+                break;
+
+            int timeout_milliseconds = -1;
+            if (settings.tile_timeout > 0.0) {
+                double left = settings.tile_timeout - (omp_get_wtime() - start);
+                if (left <= 0.0) {
+                    for (size_t k : polled) {
+                        std::cerr << "WORKER " << workers[k].pid << " DID NOT START IN TIME\n";
+                        stop_worker(workers[k], WORKER_KILLED);
+                    }
+                    break;
+                }
+                timeout_milliseconds = static_cast<int>(std::ceil(left * 1000.0));
+            }
+            if (poll(fds.data(), fds.size(), timeout_milliseconds) <= 0)
+                continue;
+
+            for (size_t f = 0; f < fds.size(); f++) {
+                if (!(fds[f].revents & (POLLIN | POLLHUP | POLLERR)))
+                    continue;
+                Worker_Process& w = workers[polled[f]];
+                char chunk[sizeof(Worker_Hello)];
+                ssize_t n = read(w.from_worker, chunk, sizeof(Worker_Hello) - w.inbox.size());
+                if (n < 0 && (errno == EINTR || errno == EAGAIN))
+                    continue;
+                if (n <= 0) {
+                    std::cerr << "WORKER " << w.pid << " DID NOT START\n";
+                    stop_worker(w, WORKER_CRASHED);
+                    continue;
+                }
+                w.inbox.insert(w.inbox.end(), chunk, chunk + n);
+                if (w.inbox.size() == sizeof(Worker_Hello)) {
+                    greeted[polled[f]] = true;
+                    accept_hello(w);
+                }
+            }
+        }
+
+        if (running_workers() == 0) {
+            std::cerr << "NO WORKER STARTED!\n";
+            return false;
+        }
+        return true;
+    }
+
+    void accept_hello(Worker_Process& w) {
+        Worker_Hello hello;
+        std::memcpy(&hello, w.inbox.data(), sizeof(hello));
+        w.inbox.clear();
+
+        if (hello.magic != TILE_PROTOCOL_MAGIC) {
+            std::cerr << "WORKER " << w.pid << " DID NOT START\n";
+            stop_worker(w, WORKER_CRASHED);
+        } else if (image_width == 0) {
+            image_width = hello.image_width;
+            image_height = hello.image_height;
+            samples_per_pixel = hello.samples_per_pixel;
+        } else if (hello.image_width != image_width || hello.image_height != image_height ||
+                   hello.samples_per_pixel != samples_per_pixel) {
+            std::cerr << "WORKER " << w.pid << " BUILT A DIFFERENT SCENE!\n";
+            stop_worker(w, WORKER_KILLED);
+        }
+    }
+
+    void dispatch() {
+        for (Worker_Process& w : workers) {
+            if (w.state != WORKER_RUNNING || w.tile >= 0)
+                continue;
+
+            int t = next_tile();
+            if (t < 0)
+                return;
+
+            const Image_Tile& tile = tiles[t];
+            Tile_Request request = {t, tile.x0, tile.y0, tile.x1, tile.y1};
+            w.tile = t;
+            w.tile_start = omp_get_wtime();
+            copies_out[t]++;
+            if (!write_fully(w.to_worker, &request, sizeof(request)))
+                worker_lost(w, WORKER_CRASHED);
+        }
+    }
+
+    int next_tile() {
+        // The next queued tile or, once the queue is empty, the straggling tile that has been out longest
+
+        while (!queue.empty()) {
+            int t = queue.front();
+            queue.pop_front();
+            if (!done[t])
+                return t;
+        }
+
+        if (tiles_done == 0)
+            return -1;
+        double average = total_tile_seconds / tiles_done;
+        double now = omp_get_wtime();
+
+        int straggler = -1;
+        double longest = settings.straggler_factor * average;
+        for (const Worker_Process& w : workers) {
+            if (w.state == WORKER_RUNNING && w.tile >= 0 && copies_out[w.tile] == 1 && now - w.tile_start > longest) {
+                straggler = w.tile;
+                longest = now - w.tile_start;
+            }
+        }
+        if (straggler >= 0)
+            std::cerr << "Tile " << straggler << " is late; sending it to another worker too\n";
+        return straggler;
+    }
+
+    void collect(int timeout_milliseconds) {
+        std::vector<pollfd> fds;
+        std::vector<Worker_Process*> polled;
+        for (Worker_Process& w : workers) {
+            if (w.state == WORKER_RUNNING && w.tile >= 0) {
+                fds.push_back({w.from_worker, POLLIN, 0});
+                polled.push_back(&w);
+            }
+        }
+        if (fds.empty() || poll(fds.data(), fds.size(), timeout_milliseconds) <= 0)
+            return;
+
+        for (size_t k = 0; k < fds.size(); k++)
+            if (fds[k].revents & (POLLIN | POLLHUP | POLLERR))
+                receive(*polled[k]);
+    }
+
+    void receive(Worker_Process& w) {
+        // Reads whatever the worker has sent so far without blocking, so a worker that stops halfway through
+        // a result cannot hang the coordinator; the result is used once all of it has arrived
+
+        char chunk[1 << 16];
+        ssize_t n = read(w.from_worker, chunk, sizeof(chunk));
+        if (n < 0 && (errno == EINTR || errno == EAGAIN))
+            return;
+        if (n <= 0) {
+            worker_lost(w, WORKER_CRASHED);
+            return;
+        }
+        w.inbox.insert(w.inbox.end(), chunk, chunk + n);
+
+        if (w.inbox.size() < sizeof(Tile_Result_Header))
+            return;
+        Tile_Result_Header header;
+        std::memcpy(&header, w.inbox.data(), sizeof(header));
+
+        if (header.tile_id != w.tile) {
+            worker_lost(w, WORKER_CRASHED);
+            return;
+        }
+        const Image_Tile& tile = tiles[header.tile_id];
+        int tile_width = tile.x1 - tile.x0;
+        if (header.pixel_count != tile_width * (tile.y1 - tile.y0)) {
+            worker_lost(w, WORKER_CRASHED);
+            return;
+        }
+
+        size_t message_size = sizeof(header) + 3 * sizeof(double) * static_cast<size_t>(header.pixel_count);
+        if (w.inbox.size() < message_size)
+            return;
+        if (w.inbox.size() > message_size) {        // a worker only sends one result per request
+            worker_lost(w, WORKER_CRASHED);
+            return;
+        }
+        std::vector<double> payload(3 * static_cast<size_t>(header.pixel_count));
+        std::memcpy(payload.data(), w.inbox.data() + sizeof(header), payload.size() * sizeof(double));
+        w.inbox.clear();
+
+        w.rays += header.rays;
+        w.render_seconds += header.seconds;
+        copies_out[header.tile_id]--;
+        w.tile = -1;
+
+        if (done[header.tile_id]) {
+            w.duplicates++;
+            return;
+        }
+
+        for (int k = 0; k < header.pixel_count; k++) {
+            int i = tile.x0 + k % tile_width;
+            int j = tile.y0 + k / tile_width;
+            pixel_colors[j][i] = Color(payload[3 * k], payload[3 * k + 1], payload[3 * k + 2]);
+        }
+        done[header.tile_id] = true;
+        tiles_done++;
+        total_tile_seconds += omp_get_wtime() - w.tile_start;
+        w.tiles++;
+        w.pixels += header.pixel_count;
+    }
+
+    void enforce_timeout() {
+        if (settings.tile_timeout <= 0.0)
+            return;
+
+        double now = omp_get_wtime();
+        for (Worker_Process& w : workers) {
+            if (w.state == WORKER_RUNNING && w.tile >= 0 && now - w.tile_start > settings.tile_timeout) {
+                std::cerr << "Worker " << w.pid << " timed out on tile " << w.tile << "\n";
+                worker_lost(w, WORKER_KILLED);
+            }
+        }
+    }
+
+    void worker_lost(Worker_Process& w, WORKER_STATE state) {
+        // The worker's tile goes back to the front of the queue, unless it is done or another copy is out
+
+        int t = w.tile;
+        if (state == WORKER_CRASHED)
+            std::cerr << "Worker " << w.pid << " crashed" << (t >= 0 ? " with tile " + std::to_string(t) : "") << "\n";
+
+        if (t >= 0) {
+            copies_out[t]--;
+            if (!done[t] && copies_out[t] == 0)
+                queue.push_front(t);
+        }
+        w.tile = -1;
+        stop_worker(w, state);
+    }
+
+    int running_workers() const {
+        int n = 0;
+        for (const Worker_Process& w : workers)
+            n += (w.state == WORKER_RUNNING);
+        return n;
+    }
+
+    void write_image() const {
+        // Reference: How to write to a PPM file? https://www.rosettacode.org/wiki/Bitmap/Write_a_PPM_file#C++
+        std::ofstream ofs(settings.image_name + ".ppm", std::ios_base::out | std::ios_base::binary);
+        ofs << "P3\n" << image_width << " " << image_height << "\n255\n";
+        for (int j = image_height - 1; j >= 0; --j) {
+            for (int i = 0; i < image_width; ++i) {
+                Color pixel_color = pixel_colors[j][i] / samples_per_pixel;
+
+                // Get rid of acne and apply 2-gamma, as the renderers do
+                double r_comp = std::isnan(pixel_color.x()) ? 0.0 : gamma_2_correction(pixel_color.x());
+                double g_comp = std::isnan(pixel_color.y()) ? 0.0 : gamma_2_correction(pixel_color.y());
+                double b_comp = std::isnan(pixel_color.z()) ? 0.0 : gamma_2_correction(pixel_color.z());
+
+                ofs << static_cast<int>(255 * clamp(r_comp, 0.0, 0.999)) << ' '
+                    << static_cast<int>(255 * clamp(g_comp, 0.0, 0.999)) << ' '
+                    << static_cast<int>(255 * clamp(b_comp, 0.0, 0.999)) << '\n';
+            }
+        }
+    }
+
+    void report(double seconds) const {
+        static const char* state_names[] = {"running", "finished", "crashed", "killed"};
+
+        std::cout << "worker,state,tiles,duplicate_tiles,pixels,rays,render_seconds,mega_rays_per_second,pixels_per_second\n";
+        long long total_rays = 0;
+        for (const Worker_Process& w : workers) {
+            total_rays += w.rays;
+            double mrays = w.render_seconds > 0.0 ? w.rays / w.render_seconds / 1e6 : 0.0;
+            double pixels_per_second = w.render_seconds > 0.0 ? w.pixels / w.render_seconds : 0.0;
+            std::cout << w.pid << ',' << state_names[w.state] << ',' << w.tiles << ',' << w.duplicates << ',' << w.pixels << ','
+                      << w.rays << ',' << w.render_seconds << ',' << mrays << ',' << pixels_per_second << '\n';
+        }
+        std::cout << "total," << image_width << 'x' << image_height << ',' << tiles.size() << ",," << image_width * image_height
+                  << ',' << total_rays << ',' << seconds << ',' << total_rays / seconds / 1e6 << ','
+                  << image_width * image_height / seconds << std::endl;
+        std::cerr << "Name of file rendered: " << settings.image_name << "\n";
+    }
+
+    // Data Members
+    // -----------------------------------------------------------------------
+    Coordinator_Settings settings;
+    std::vector<Worker_Process> workers;
+
+    int image_width = 0;
+    int image_height = 0;
+    int samples_per_pixel = 0;
+    std::vector<Image_Tile> tiles;
+    std::vector<bool> done;
+    std::vector<int> copies_out;            // workers currently rendering each tile
+    std::deque<int> queue;                  // tiles waiting for a worker
+    int tiles_done = 0;
+    double total_tile_seconds = 0.0;        // coordinator-side time of the finished tiles
+    std::vector<std::vector<Color>> pixel_colors;
+};
+
+int main(int argc, char** argv) {
+    Coordinator_Settings settings;
+    if (!parse_arguments(argc, argv, settings)) {
+        print_usage();
+        return 1;
+    }
+
+    settings.program = argv[0];
+    if (settings.worker)
+        return run_worker(settings);
+    return Render_Coordinator(settings).run();
+}
@@ -0,0 +1,113 @@
+//
+// Created by Rami on 10/19/2026.
+//
+
+// Renders one range of sample indices of a scene into an accumulation buffer, so that a frame can be split
+// across processes or machines without any network service: give each process a disjoint range,
+//
+//      CUDA_Ray_Tracer_Render_Samples --scene full_Cornell --first-sample 0    --spp 1000 --buffer part_0.acc
+//      CUDA_Ray_Tracer_Render_Samples --scene full_Cornell --first-sample 1000 --spp 1000 --buffer part_1.acc
+//      CUDA_Ray_Tracer_Render_Samples --scene full_Cornell --first-sample 2000 --spp 1000 --buffer part_2.acc
+//
+// and add the buffers up with CUDA_Ray_Tracer_Merge_Buffers. The buffer is also a checkpoint: it is saved
+// every --checkpoint-interval seconds and on SIGINT/SIGTERM, and running the same command again resumes it.
+// Merging the buffers while they are still being rendered gives a preview.
+
+#include "../Rendering/Checkpointed_Rendering_Functions.h"
+#include "../Scene_Registry.h"
+
+struct Render_Samples_Settings {
+    std::string scene;
+    std::string buffer_file;
+    int first_sample = 0;
+    int samples_per_pixel = 0;              // 0 keeps the scene's value (same for width and depth)
+    int image_width = 0;
+    int max_depth = 0;
+    int threads = 16;
+    double checkpoint_interval = 300.0;
+};
+
+void print_usage() {
+    std::cerr << "Usage: CUDA_Ray_Tracer_Render_Samples --scene NAME --buffer FILE [options]\n"
+              << "  --scene NAME         " << list_entries(scenes) << ", or a .scene file\n"
+              << "  --buffer FILE        accumulation buffer to write (and to resume from if it exists)\n"
+              << "  --first-sample N     index of the first sample of every pixel (default 0)\n"
+              << "  --spp N              number of samples per pixel to render (default: the scene's)\n"
+              << "  --width N            image width; the height follows the scene's aspect ratio (default: the scene's)\n"
+              << "  --depth N            maximum ray depth (default: the scene's)\n"
+              << "  --threads N          OpenMP threads (default 16)\n"
+              << "  --checkpoint-interval SECONDS   seconds between saves of the buffer (default 300)\n";
+}
+
+bool parse_arguments(int argc, char** argv, Render_Samples_Settings& settings) {
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (option == "--help" || option == "-h")
+            return false;
+        if (i + 1 >= argc) {
+            std::cerr << "MISSING VALUE FOR " << option << "\n";
+            return false;
+        }
+        std::string value = argv[++i];
+
+        if (option == "--scene") settings.scene = value;
+        else if (option == "--buffer") settings.buffer_file = value;
+        else if (option == "--first-sample") settings.first_sample = std::atoi(value.c_str());
+        else if (option == "--spp") settings.samples_per_pixel = std::atoi(value.c_str());
+        else if (option == "--width") settings.image_width = std::atoi(value.c_str());
+        else if (option == "--depth") settings.max_depth = std::atoi(value.c_str());
+        else if (option == "--threads") settings.threads = std::atoi(value.c_str());
+        else if (option == "--checkpoint-interval") settings.checkpoint_interval = std::atof(value.c_str());
+        else {
+            std::cerr << "INVALID OPTION: " << option << "\n";
+            return false;
+        }
+    }
+
+    if (!scene_exists(settings.scene)) {
+        std::cerr << "UNKNOWN SCENE: " << settings.scene << "\n";
+        return false;
+    }
+    if (settings.buffer_file.empty()) {
+        std::cerr << "NO --buffer FILE GIVEN!\n";
+        return false;
+    }
+    if (settings.first_sample < 0 || settings.threads < 1) {
+        std::cerr << "FIRST SAMPLE MUST NOT BE NEGATIVE AND THREADS MUST BE POSITIVE!\n";
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Render_Samples_Settings settings;
+    if (!parse_arguments(argc, argv, settings)) {
+        print_usage();
+        return 1;
+    }
+
+    Scene_Information scene_info = build_scene(settings.scene);
+    if (settings.image_width > 0) {
+        scene_info.image_width = settings.image_width;
+        scene_info.image_height = static_cast<int>(scene_info.image_width / scene_info.aspect_ratio);
+    }
+    if (settings.samples_per_pixel > 0)
+        scene_info.samples_per_pixel = settings.samples_per_pixel;
+    if (settings.max_depth > 0)
+        scene_info.max_depth = settings.max_depth;
+    scene_info.number_of_threads_used = settings.threads;
+
+    // The buffer's label is the scene's output_image_name, the same in every process, so the parts can be merged
+    scene_info.first_sample = settings.first_sample;
+    scene_info.checkpoint.enabled = true;
+    scene_info.checkpoint.file = settings.buffer_file;
+    scene_info.checkpoint.interval = settings.checkpoint_interval;
+    scene_info.checkpoint.write_image = false;
+
+    parallel_checkpointed_radiance_mixture_renderer(scene_info);
+
+    std::cout << "Samples " << settings.first_sample << " to " << settings.first_sample + scene_info.samples_per_pixel - 1
+              << " of " << scene_info.output_image_name << " written to " << settings.buffer_file
+              << " in " << scene_info.render_time << " seconds" << std::endl;
+    return 0;
+}
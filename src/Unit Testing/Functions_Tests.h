@@ -7,6 +7,7 @@
 
 #include "../Utilities.h"
 #include "../Primitives/Sphere.h"
+#include "../Rendering/Wavefront_Rendering_Functions.h"
 
 namespace UNIT_TEST {
     // Test if the geometric solution is correct
@@ -339,6 +340,90 @@ namespace UNIT_TEST {
             }
         }
     }
+
+    // Test the fast math tiers against libm (see Fast_Math.h for the bounds)
+    // -------------------------------------------------------------------
+    bool within_bound(const char* tier, const char* function, double worst_error, double bound) {
+        bool passed = worst_error <= bound;
+        std::cout << tier << " " << function << ": max error " << worst_error << " (bound " << bound << ") "
+                  << (passed ? "passed" : "FAILED") << "\n";
+        return passed;
+    }
+
+    template <typename Math>
+    bool test_math_tier(int samples = 1000000) {
+        const double bound = Math::max_error();
+        double sin_error = 0, cos_error = 0, acos_error = 0, exp_error = 0, log_error = 0, pow_error = 0;
+
+        for (int i = 0; i <= samples; i++) {
+            double u = static_cast<double>(i) / samples;
+
+            // sin and cos absolute, over the angles the samplers use and some way beyond
+            double x = -8 * M_PI + 16 * M_PI * u;
+            double s, c;
+            Math::sincos(x, s, c);
+            sin_error = fmax(sin_error, fmax(fabs(s - std::sin(x)), fabs(Math::sin(x) - std::sin(x))));
+            cos_error = fmax(cos_error, fmax(fabs(c - std::cos(x)), fabs(Math::cos(x) - std::cos(x))));
+
+            // acos absolute, on [-1,1]
+            double t = 2 * u - 1;
+            acos_error = fmax(acos_error, fabs(Math::acos(t) - std::acos(t)));
+
+            // exp and log relative
+            double e = -700 + 1400 * u;
+            exp_error = fmax(exp_error, fabs(Math::exp(e) / std::exp(e) - 1));
+            double l = std::exp(-700 + 1400 * u);
+            log_error = fmax(log_error, fabs(Math::log(l) - std::log(l)) / fmax(fabs(std::log(l)), 1e-300));
+
+            // pow relative, on the cosines and exponents of the Phong lobes, scaled by 1 + |y log(x)|; subnormal
+            // results have fewer bits than the bound and are left out
+            double base = 1e-4 + (1 - 1e-4) * u;
+            double y = 1 + 1000 * fmod(u * 7919, 1.0);
+            double reference = std::pow(base, y);
+            if (reference >= std::numeric_limits<double>::min())
+                pow_error = fmax(pow_error, fabs(Math::pow(base, y) / reference - 1) / (1 + fabs(y * std::log(base))));
+        }
+
+        // A few ulps of rounding on top of the truncation error of the polynomials
+        const double rounding = 1e-15;
+        bool passed = within_bound(Math::name(), "sin", sin_error, bound + rounding);
+        passed &= within_bound(Math::name(), "cos", cos_error, bound + rounding);
+        passed &= within_bound(Math::name(), "acos", acos_error, bound + rounding);
+        passed &= within_bound(Math::name(), "exp", exp_error, bound + rounding);
+        passed &= within_bound(Math::name(), "log", log_error, bound + rounding);
+        passed &= within_bound(Math::name(), "pow", pow_error, bound + rounding);
+        return passed;
+    }
+
+    void test_fast_math_error_bounds() {
+        bool passed = test_math_tier<Accurate_Math>();
+        passed &= test_math_tier<Fast_Math>();
+        std::cout << (passed ? "All fast math tiers are within their bounds.\n" : "FAST MATH BOUNDS EXCEEDED.\n");
+    }
+
+    // Test that the ray binning key keeps rays of different octants apart (see Wavefront_Rendering_Functions.h)
+    // -------------------------------------------------------------------
+    void test_ray_binning_key() {
+        const point3D scene_min(0, 0, 0);
+        const Vec3D inverse_scene_extent(1, 1, 1);
+
+        // The far corner of the grid sets every bit of the Morton code
+        const point3D origins[] = {point3D(0, 0, 0), point3D(0.3, 0.6, 0.9), point3D(1, 1, 1)};
+        bool passed = true;
+        for (const point3D& origin : origins) {
+            for (uint32_t a = 0; a < 8; a++) {
+                Vec3D direction_a((a & 4) ? -1 : 1, (a & 2) ? -1 : 1, (a & 1) ? -1 : 1);
+                uint32_t key_a = ray_binning_key(origin, direction_a, scene_min, inverse_scene_extent);
+                passed &= (key_a >> 27) == a;
+
+                for (uint32_t b = a + 1; b < 8; b++) {
+                    Vec3D direction_b((b & 4) ? -1 : 1, (b & 2) ? -1 : 1, (b & 1) ? -1 : 1);
+                    passed &= key_a != ray_binning_key(origin, direction_b, scene_min, inverse_scene_extent);
+                }
+            }
+        }
+        std::cout << (passed ? "Ray binning keys separate the octants.\n" : "RAY BINNING KEYS MIX OCTANTS.\n");
+    }
 }
 
 namespace BENCHMARK {
@@ -22,6 +22,8 @@
 #include "Mathematics/Vec3D.h"
 #include "Mathematics/Vec2D.h"
 #include "Mathematics/Ray.h"
+#include "Mathematics/ONB.h"
+#include "Mathematics/Fast_Math.h"
 #include "Mathematics/Probability/Randomized_Algorithms.h"
 
 // Include Constants
@@ -136,20 +138,14 @@ inline Vec3D global_to_ONB_local(Vec3D ONB_axes[3], double a, double b, double c
     return a*ONB_axes[0] + b*ONB_axes[1] + c*ONB_axes[2];
 }
 
-inline Vec3D global_to_ONB_local(const std::vector<Vec3D>& ONB_axes, const Vec3D& v){
-    //std::cout << "INSIDE MY FUNCTION: " << ONB_axes[0] << " , " << ONB_axes[1] << " , " << ONB_axes[2] << std::endl;
-    return v.x()*ONB_axes[0] + v.y()*ONB_axes[1] + v.z()*ONB_axes[2];
+inline Vec3D global_to_ONB_local(const ONB& ONB_axes, const Vec3D& v){
+    return ONB_axes.to_world(v);
 }
 
-std::vector<Vec3D> build_ONB(const Vec3D& w){
-    // Constructs and returns an orthonormal basis from the given vector w.
+inline ONB build_ONB(const Vec3D& w){
+    // Constructs and returns an orthonormal basis from the given vector w (see Mathematics/ONB.h).
 
-    Vec3D unit_w = unit_vector(w);
-    Vec3D a = (fabs(unit_w.x()) > 0.9) ? Vec3D(0,1,0) : Vec3D(1,0,0);
-    Vec3D v = unit_vector(cross_product(unit_w, a));
-    Vec3D u = cross_product(unit_w, v);
-    std::vector<Vec3D> ONB = {u, v, unit_w};
-    return ONB;
+    return ONB(w);
 }
 
 
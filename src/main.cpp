@@ -1,5 +1,8 @@
 #include "Rendering/Serial_Rendering_Functions.h"
 #include "Rendering/Parallel_Rendering_Functions.h"
+#include "Rendering/Wavefront_Rendering_Functions.h"
+#include "Rendering/Checkpointed_Rendering_Functions.h"
+#include "Scene_File.h"
 #include "Unit Testing/Functions_Tests.h"
 
 int main() {
@@ -18,6 +21,22 @@ int main() {
         // Scene_Information scene_info = full_Cornell_box();
         Scene_Information scene_info = texture_Cornell_box();
         // Scene_Information scene_info = different_diffuse_models_scene();
+        // Scene_Information scene_info = motion_blur_and_depth_of_field_scene();
+        // Scene_Information scene_info = many_lights_Cornell_box();
+
+        // ... or load a scene file (see Scene_File.h), which needs no recompiling to change
+        // Scene_Information scene_info = load_scene_file("scenes/cornell_box.scene");
+
+        // Post-processing: render at 64-256 spp and denoise instead of thousands of spp
+        // -----------------------------------------------------------------------
+        // scene_info.samples_per_pixel = 128;
+        // scene_info.denoiser.denoise = true;
+        // scene_info.denoiser.write_AOVs = true;                               // <image>_albedo/_normal/_depth.ppm
+
+        // Checkpointing: resumes from <image>.checkpoint if it exists, saves it every 5 minutes and on Ctrl-C
+        // (render with parallel_checkpointed_radiance_mixture_renderer below)
+        // -----------------------------------------------------------------------
+        // scene_info.checkpoint.enabled = true;
 
         // Serial rendering function
         // -----------------------------------------------------------------------
@@ -34,6 +53,9 @@ int main() {
         // parallel_loop_radiance_mixture_renderer(scene_info);
         parallel_tasks_radiance_mixture_renderer(scene_info);                   // my to-go function
         // parallel_cols_workload_radiance_mixture_renderer(scene_info);
+        // wavefront_radiance_mixture_renderer(scene_info);                     // same estimator, traced bounce by bounce in waves
+        // wavefront_sorted_radiance_mixture_renderer(scene_info);              // ... with the secondary rays binned for coherence
+        // parallel_checkpointed_radiance_mixture_renderer(scene_info);         // in passes, with checkpoint/resume
 
         auto stop = omp_get_wtime();
         auto duration = stop - start;